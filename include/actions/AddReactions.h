@@ -37,6 +37,10 @@ protected:
   virtual void addAuxRate(const std::string & aux_kernel_name,
                           const unsigned & reaction_num);
 
+  /// Whether to evaluate rates once per qp with a ReactionRates material
+  const bool _use_rate_material;
+  /// Whether the species source terms are integrated by a ReactionNetworkSplit user object
+  const bool _split_chemistry;
   std::string _coefficient_format;
   std::string _log_append;
   std::vector<std::string> _reactant_names;
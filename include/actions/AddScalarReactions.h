@@ -22,10 +22,49 @@ public:
   static InputParameters validParams();
 
   const std::string _interpolation_type;
+  /// Whether to add one ReactionNetworkScalar kernel instead of per-species reaction kernels
+  const bool _use_network_kernel;
+  /// Whether all equation rates are evaluated together by one RateExpressionEvaluator
+  const bool _batch_rate_equations;
+  /// Whether track_rates adds a ScalarReactionRates vector postprocessor instead of aux variables
+  const bool _rate_vector;
   // AddScalarReactions(const InputParameters & params) : ChemicalReactionsBase(params) {};
 
   virtual void act();
 
 //protected:
+  /// Adds a single ReactionNetworkScalar kernel covering every reaction and species
+  void addNetworkKernel();
+  /// A basis of the linear conservation laws w (sum_j w_j N_j constant) of the network
+  std::vector<std::vector<Real>> conservationLaws() const;
+  /**
+   * Assigns a conservation law to each species that is not a nonlinear variable and expresses it
+   * in the species that are (_conservation_coeff). Runs once, after the variables are added.
+   */
+  void findConservedSpecies();
+  /// Adds a MechanismReduction user object sampling every reaction of this block
+  void addMechanismReduction();
+  /**
+   * The reactants of every reaction that is not lumped, as indices into _species followed by the
+   * untracked reactants, which are appended to `args`
+   */
+  std::vector<std::vector<unsigned int>> networkReactants(std::vector<VariableName> & args) const;
+  /// The nonzero net stoichiometric coefficients of every reaction that is not lumped, and the
+  /// indices into _species they belong to
+  void networkStoichiometry(std::vector<std::vector<unsigned int>> & stoich_species,
+                            std::vector<std::vector<Real>> & stoich_coeff) const;
+
   std::vector<std::string> _aux_scalar_var_name;
+  /// Index of each equation reaction in the RateExpressionEvaluator (if _batch_rate_equations)
+  std::vector<unsigned int> _rate_expression_index;
+  /// Whether species fixed by conservation laws are reconstructed instead of solved for
+  const bool _eliminate_conserved;
+  bool _conserved_species_found;
+  /// Indices of the species reconstructed from conservation laws, and of the tracked species
+  std::vector<unsigned int> _conserved_species;
+  std::vector<unsigned int> _tracked_species;
+  /// Coefficient of each tracked species in the conservation law of each conserved species
+  std::vector<std::vector<Real>> _conservation_coeff;
+  /// Indices of the species in quasi-steady state
+  std::vector<unsigned int> _qss_species;
 };
@@ -31,6 +31,10 @@ protected:
                              const std::string & kernel_name);
                              */
   virtual void addEEDFCoefficient(const unsigned & reaction_num);
+  /// Adds one EEDFRateCoefficients material for all EEDF reactions
+  virtual void addEEDFCoefficients();
+  /// The rate coefficient table of an EEDF reaction, relative to file_location
+  std::string getEEDFPropertyFile(const unsigned & reaction_num);
   virtual void addEEDFKernel(const unsigned & reaction_num,
                              const unsigned & species_num,
                              const std::string & kernel_name,
@@ -75,6 +79,12 @@ protected:
 
   std::string _coefficient_format;
   bool _use_ad;
+  /// Whether to evaluate constant and equation-based rates once per qp with ReactionRates
+  bool _use_rate_material;
+  /// Whether all EEDF rate coefficients are sampled by one EEDFRateCoefficients material
+  bool _combine_eedf_tables;
+  /// Whether the species source terms are integrated by a ReactionNetworkSplit user object
+  bool _split_chemistry;
 
   std::string _ad_prepend;
   std::string _townsend_append;
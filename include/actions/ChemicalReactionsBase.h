@@ -24,6 +24,33 @@ public:
   virtual void act();
 
 protected:
+  /// Constant and equation-based reactions, whose rates can be cached by ReactionRates
+  std::vector<unsigned int> getRateMaterialReactions();
+  /// Adds a ReactionRates material that evaluates the rates of the given reactions once per qp
+  void addReactionRatesMaterial(const std::vector<unsigned int> & reaction_nums,
+                                const std::vector<SubdomainName> & block);
+  /// Adds one ReactionNetworkSource kernel per species, reading from the ReactionRates material
+  void addReactionNetworkSources(const std::vector<unsigned int> & reaction_nums,
+                                 const std::vector<SubdomainName> & block);
+  /// Adds a ReactionNetworkSplit user object that integrates the given reactions node by node
+  /// (reads the operator_split and split_* parameters of the derived action)
+  void addReactionNetworkSplit(const std::vector<unsigned int> & reaction_nums,
+                               const std::vector<SubdomainName> & block);
+  /**
+   * Adds the Jacobian coupling implied by the network to the problem's coupling matrix: each
+   * species of `species_reactions` is coupled to the reactants of those reactions and to the
+   * variables their rate coefficients depend on (`eedf_variables` for EEDF reactions, the
+   * nonlinear equation_variables for equation-based ones). With `energy_terms`, the electron
+   * energy is coupled in the same way for every reaction that changes it. Must be called after
+   * the preconditioner is set up and before the problem is initialized.
+   */
+  void addNetworkCoupling(const std::vector<unsigned int> & species_reactions,
+                          bool energy_terms,
+                          const std::vector<VariableName> & eedf_variables);
+  /// The line of the `reactions` input that reaction i was parsed from (lumped and superelastic
+  /// reactions map back to the line they were generated from)
+  unsigned int inputLine(unsigned int i) const;
+
   const std::vector<NonlinearVariableName> _species;
   std::vector<std::string> _aux_species;
   const std::vector<NonlinearVariableName> _electron_energy;
@@ -49,6 +76,8 @@ protected:
   /// Vector of parsed reactions
   std::vector<Real> _threshold_energy;
   std::vector<std::string> _reaction;
+  /// Lines of the `reactions` input, one per input reaction, as written (without comment lines)
+  std::vector<std::string> _reaction_line;
   std::vector<std::string> _reaction_coefficient_name;
   std::vector<bool> _rate_equation;
   std::vector<std::string> _rate_type;
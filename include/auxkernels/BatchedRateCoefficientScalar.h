@@ -0,0 +1,31 @@
+//* This file is part of Crane, an open-source
+//* application for plasma chemistry and thermochemistry
+//* https://github.com/lcpp-org/crane
+//*
+//* Crane is powered by the MOOSE Framework
+//* https://www.mooseframework.org
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "AuxScalarKernel.h"
+#include "RateExpressionEvaluator.h"
+
+/**
+ * Copies one rate coefficient out of a RateExpressionEvaluator.
+ */
+class BatchedRateCoefficientScalar : public AuxScalarKernel
+{
+public:
+  BatchedRateCoefficientScalar(const InputParameters & parameters);
+
+  static InputParameters validParams();
+
+protected:
+  virtual Real computeValue() override;
+
+  const RateExpressionEvaluator & _data;
+  const unsigned int _expression_index;
+};
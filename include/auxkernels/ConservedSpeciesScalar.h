@@ -0,0 +1,32 @@
+//* This file is part of Crane, an open-source
+//* application for plasma chemistry and thermochemistry
+//* https://github.com/lcpp-org/crane
+//*
+//* Crane is powered by the MOOSE Framework
+//* https://www.mooseframework.org
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "AuxScalarKernel.h"
+
+/**
+ * Reconstructs a species fixed by a conservation law of the reaction network from the species
+ * that are solved for: N = N_old + sum_j c_j (N_j_old - N_j).
+ */
+class ConservedSpeciesScalar : public AuxScalarKernel
+{
+public:
+  ConservedSpeciesScalar(const InputParameters & parameters);
+
+  static InputParameters validParams();
+
+protected:
+  virtual Real computeValue() override;
+
+  const std::vector<Real> _coeff;
+  std::vector<const VariableValue *> _species;
+  std::vector<const VariableValue *> _species_old;
+};
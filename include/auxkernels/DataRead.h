@@ -23,7 +23,7 @@ public:
 
 protected:
   virtual Real computeValue();
-  SplineInterpolation _coefficient_interpolation;
+  std::shared_ptr<const SplineInterpolation> _coefficient_interpolation;
   // LinearInterpolation _coefficient_interpolation_linear;
   const VariableValue & _sampler_var;
   Real _sampler_const;
@@ -24,7 +24,7 @@ public:
 protected:
   virtual Real computeValue();
 
-  SplineInterpolation _mobility;
+  std::shared_ptr<const SplineInterpolation> _mobility;
 
   const VariableValue & _reduced_field;
 };
@@ -33,6 +33,8 @@ protected:
    * points coincide with the nodes.
    */
   virtual Real computeValue() override;
+  /// Computes all components within one timed section
+  virtual void compute() override;
 
   std::string _function;
 
@@ -44,4 +46,7 @@ protected:
   // const ValueProvider & _data;
 
   SymFunctionPtr _func_F;
+
+  /// Timed section of the kernel execution
+  const PerfID _compute_timer;
 };
@@ -0,0 +1,35 @@
+//* This file is part of Crane, an open-source
+//* application for plasma chemistry and thermochemistry
+//* https://github.com/lcpp-org/crane
+//*
+//* Crane is powered by the MOOSE Framework
+//* https://www.mooseframework.org
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "AuxScalarKernel.h"
+
+class ReactionNetworkScalar;
+
+/**
+ * Stores the density of a quasi-steady species, solved by a ReactionNetworkScalar kernel from the
+ * balance of its production and loss at the current solution.
+ */
+class QuasiSteadySpeciesScalar : public AuxScalarKernel
+{
+public:
+  QuasiSteadySpeciesScalar(const InputParameters & parameters);
+
+  static InputParameters validParams();
+
+  virtual void initialSetup() override;
+
+protected:
+  virtual Real computeValue() override;
+
+  const unsigned int _index;
+  ReactionNetworkScalar * _network;
+};
@@ -11,7 +11,7 @@
 #pragma once
 
 #include "AuxScalarKernel.h"
-#include "LinearInterpolation.h"
+#include "MultiRateTable.h"
 
 class ScalarLinearInterpolation : public AuxScalarKernel
 {
@@ -22,11 +22,15 @@ public:
 
 protected:
   virtual Real computeValue();
-  LinearInterpolation _coefficient_interpolation;
+  /// Computes all components within one timed section
+  virtual void compute() override;
+  std::unique_ptr<MultiRateTable> _coefficient_interpolation;
   const VariableValue & _sampler_var;
   Real _sampler_const;
   std::string _sampling_format;
   bool _use_time;
   bool _use_log;
   Real _scale_factor;
+  /// Timed section of the kernel execution
+  const PerfID _compute_timer;
 };
@@ -22,7 +22,9 @@ public:
 
 protected:
   virtual Real computeValue();
-  SplineInterpolation _coefficient_interpolation;
+  /// Computes all components within one timed section
+  virtual void compute() override;
+  std::shared_ptr<const SplineInterpolation> _coefficient_interpolation;
   const VariableValue & _sampler_var;
   Real _sampler_const;
   std::string _sampling_format;
@@ -30,4 +32,6 @@ protected:
   bool _use_log;
   std::string _interpolation_type;
   Real _scale_factor;
+  /// Timed section of the kernel execution
+  const PerfID _compute_timer;
 };
@@ -0,0 +1,90 @@
+//* This file is part of Crane, an open-source
+//* application for plasma chemistry and thermochemistry
+//* https://github.com/lcpp-org/crane
+//*
+//* Crane is powered by the MOOSE Framework
+//* https://www.mooseframework.org
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "Transient.h"
+#include "RosenbrockIntegrator.h"
+
+#include <fstream>
+
+class ReactionNetworkScalar;
+class MooseVariableScalar;
+
+/**
+ * Transient executioner for zero-dimensional reaction networks that integrates the species
+ * densities directly instead of solving the discretized system with PETSc.
+ *
+ * The species must be nonlinear scalar variables whose only scalar kernels are time derivatives
+ * and ReactionNetworkScalar kernels (use_network_kernel = true in the ScalarNetwork action). Each
+ * step refreshes the user objects and aux variables (rate coefficients, reduced field, ...) at the
+ * start of the step, holds them fixed over the step and integrates dN/dt = S r(N) with an
+ * adaptive Rosenbrock method on the analytic network Jacobian. Time stepping, outputs and user
+ * objects otherwise behave as in Transient.
+ *
+ * An ensemble of cases that differ in the initial values of some species or in the values of some
+ * aux variables can be run together. The aux variables are evaluated for each member in turn, and
+ * the members are then integrated together with the network evaluated for all of them at once.
+ * The problem's variables, and so its outputs, follow the first member.
+ */
+class ScalarNetworkTransient : public Transient
+{
+public:
+  static InputParameters validParams();
+
+  ScalarNetworkTransient(const InputParameters & parameters);
+
+  virtual void init() override;
+  virtual void takeStep(Real input_dt = -1.0) override;
+
+protected:
+  /// Integrates the network from _time_old to _time; returns false if max_substeps were not enough
+  bool integrateStep();
+  /// Evaluates dN/dt (and optionally its Jacobian) of the listed ensemble members
+  void networkRates(const std::vector<unsigned int> & members,
+                    const std::vector<Real> & y,
+                    std::vector<Real> & f,
+                    Real * jacobian);
+  /// Sets the species and ensemble aux variables of the problem to the values of member m
+  void loadMember(unsigned int m);
+  /// Appends the species of every member at the current time to ensemble_file
+  void writeEnsemble();
+
+  RosenbrockIntegrator _integrator;
+
+  /// The species, and whether each is stored as a log density
+  std::vector<MooseVariableScalar *> _species;
+  std::vector<bool> _log_species;
+  /// The network kernels and, for each, the index in _species of each of its tracked species
+  std::vector<const ReactionNetworkScalar *> _networks;
+  std::vector<std::vector<unsigned int>> _network_species;
+
+  /// Number of ensemble members (1 without an ensemble)
+  unsigned int _members;
+  /// Aux variables set per member, and their values stored member by member
+  std::vector<MooseVariableScalar *> _ensemble_aux;
+  std::vector<Real> _ensemble_aux_values;
+  /// Values of the species as stored in the variables (log densities if use_log), member by member
+  std::vector<Real> _member_values;
+
+  /// Densities of the species and the substep size carried between steps, for each member
+  std::vector<Real> _density;
+  std::vector<Real> _substep;
+  /// Frozen inputs (see ReactionNetworkScalar::frozenInputs) of each network, member-fastest
+  std::vector<std::vector<Real>> _network_inputs;
+
+  /// Work arrays for the network kernels, member-fastest
+  std::vector<Real> _local_inputs;
+  std::vector<Real> _local_density;
+  std::vector<Real> _local_rates;
+  std::vector<Real> _local_jacobian;
+
+  std::ofstream _ensemble_output;
+};
@@ -0,0 +1,46 @@
+//* This file is part of Crane, an open-source
+//* application for plasma chemistry and thermochemistry
+//* https://github.com/lcpp-org/crane
+//*
+//* Crane is powered by the MOOSE Framework
+//* https://www.mooseframework.org
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "GenericKernel.h"
+
+/**
+ * Sums the source and sink terms of one species over all reactions it participates in, reading
+ * the reaction rates (and their derivatives) computed by ReactionRates.
+ */
+template <bool is_ad>
+class ReactionNetworkSourceTempl : public GenericKernel<is_ad>
+{
+public:
+  ReactionNetworkSourceTempl(const InputParameters & parameters);
+
+  static InputParameters validParams();
+
+protected:
+  virtual GenericReal<is_ad> computeQpResidual();
+  virtual Real computeQpJacobian();
+  virtual Real computeQpOffDiagJacobian(unsigned int jvar);
+
+  /// Net stoichiometric coefficient of this species in each reaction
+  const std::vector<Real> _stoichiometric_coeff;
+  /// Rate of each reaction
+  std::vector<const GenericMaterialProperty<Real, is_ad> *> _rate;
+
+  /// For every (reaction, coupled reactant) pair: the reaction, variable number and d(rate)/d(var)
+  std::vector<unsigned int> _derivative_reaction;
+  std::vector<unsigned int> _derivative_var;
+  std::vector<const MaterialProperty<Real> *> _d_rate;
+
+  usingGenericKernelMembers;
+};
+
+typedef ReactionNetworkSourceTempl<false> ReactionNetworkSource;
+typedef ReactionNetworkSourceTempl<true> ADReactionNetworkSource;
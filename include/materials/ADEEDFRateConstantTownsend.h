@@ -24,7 +24,7 @@ public:
 protected:
   virtual void computeQpProperties();
 
-  SplineInterpolation _coefficient_interpolation;
+  std::shared_ptr<const SplineInterpolation> _coefficient_interpolation;
 
   std::string _coefficient_format;
   ADMaterialProperty<Real> & _townsend_coefficient;
@@ -25,7 +25,7 @@ protected:
   virtual void computeQpProperties();
 
   //std::unique_ptr<LinearInterpolation> _coefficient_interpolation;
-  SplineInterpolation _coefficient_interpolation;
+  std::shared_ptr<const SplineInterpolation> _coefficient_interpolation;
 
   Real _r_units;
   ADMaterialProperty<Real> & _rate_coefficient;
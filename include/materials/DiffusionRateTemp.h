@@ -23,7 +23,7 @@ public:
 protected:
   virtual void computeQpProperties();
 
-  SplineInterpolation _elec_temp;
+  std::shared_ptr<const SplineInterpolation> _elec_temp;
 
   MaterialProperty<Real> & _diff_rate;
   const MaterialProperty<Real> & _gap_length;
@@ -0,0 +1,43 @@
+//* This file is part of Crane, an open-source
+//* application for plasma chemistry and thermochemistry
+//* https://github.com/lcpp-org/crane
+//*
+//* Crane is powered by the MOOSE Framework
+//* https://www.mooseframework.org
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "Material.h"
+#include "MultiRateTable.h"
+
+/**
+ * Samples the tabulated EEDF rate coefficients of many reactions at the local mean electron energy
+ * with one MultiRateTable, so tables on a shared energy grid need a single interval search per
+ * quadrature point. Declares the same properties as one ZapdosEEDFRateConstant per reaction.
+ */
+class EEDFRateCoefficients : public Material
+{
+public:
+  EEDFRateCoefficients(const InputParameters & parameters);
+
+  static InputParameters validParams();
+
+protected:
+  virtual void computeQpProperties() override;
+
+  std::unique_ptr<MultiRateTable> _table;
+  const bool _linear;
+
+  std::vector<MaterialProperty<Real> *> _reaction_rate;
+  std::vector<MaterialProperty<Real> *> _d_k_d_en;
+
+  const VariableValue & _em;
+  const VariableValue & _mean_en;
+
+  /// Sampled values and derivatives of all tables
+  std::vector<Real> _k;
+  std::vector<Real> _dk;
+};
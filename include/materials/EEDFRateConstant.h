@@ -11,8 +11,7 @@
 #pragma once
 
 #include "Material.h"
-/* #include "LinearInterpolation.h" */
-#include "SplineInterpolation.h"
+#include "MultiRateTable.h"
 
 class EEDFRateConstant : public Material
 {
@@ -24,7 +23,7 @@ public:
 protected:
   virtual void computeQpProperties();
 
-  SplineInterpolation _coefficient_interpolation;
+  std::unique_ptr<MultiRateTable> _coefficient_interpolation;
 
   MaterialProperty<Real> & _reaction_rate;
   MaterialProperty<Real> & _d_k_d_en;
@@ -24,7 +24,7 @@ protected:
   virtual void initQpStatefulProperties() override;
   virtual void computeQpProperties() override;
 
-  SplineInterpolation _mobility;
+  std::shared_ptr<const SplineInterpolation> _mobility;
 
   MaterialProperty<Real> & _reduced_field;
   const MaterialProperty<Real> & _voltage;
@@ -24,7 +24,7 @@ public:
 protected:
   virtual void computeQpProperties();
 
-  std::unique_ptr<LinearInterpolation> _coefficient_interpolation;
+  std::shared_ptr<const LinearInterpolation> _coefficient_interpolation;
 
   ADMaterialProperty<Real> & _coefficient;
   const ADVariableValue & _em;
@@ -22,7 +22,7 @@ public:
 protected:
   virtual void computeQpProperties();
 
-  SplineInterpolation _coefficient_interpolation;
+  std::shared_ptr<const SplineInterpolation> _coefficient_interpolation;
 
   ADMaterialProperty<Real> & _coefficient;
   const ADVariableValue & _em;
@@ -0,0 +1,52 @@
+//* This file is part of Crane, an open-source
+//* application for plasma chemistry and thermochemistry
+//* https://github.com/lcpp-org/crane
+//*
+//* Crane is powered by the MOOSE Framework
+//* https://www.mooseframework.org
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "Material.h"
+
+/**
+ * Evaluates the rate (k * n1 * n2 * ...) of every reaction in a network once per quadrature
+ * point, along with its derivative with respect to each reactant (non-AD only). Species kernels
+ * such as ReactionNetworkSource read these properties instead of recomputing the rates.
+ */
+template <bool is_ad>
+class ReactionRatesTempl : public Material
+{
+public:
+  ReactionRatesTempl(const InputParameters & parameters);
+
+  static InputParameters validParams();
+
+protected:
+  virtual void computeQpProperties() override;
+
+  const bool _use_log;
+  const unsigned int _num_reactions;
+
+  /// Values of the distinct reactants in the network
+  std::vector<const GenericVariableValue<is_ad> *> _reactant_value;
+  /// Rate coefficient of each reaction
+  std::vector<const MaterialProperty<Real> *> _rate_coefficient;
+  /// Rate of each reaction
+  std::vector<GenericMaterialProperty<Real, is_ad> *> _rate;
+
+  /// Reactants of each reaction as indices into _reactant_value (CSR layout)
+  std::vector<unsigned int> _reactant_offset;
+  std::vector<unsigned int> _reactant;
+
+  /// Distinct reactants of each reaction and d(rate)/d(reactant) (CSR layout, non-AD only)
+  std::vector<unsigned int> _derivative_offset;
+  std::vector<unsigned int> _derivative_reactant;
+  std::vector<MaterialProperty<Real> *> _d_rate;
+};
+
+typedef ReactionRatesTempl<false> ReactionRates;
+typedef ReactionRatesTempl<true> ADReactionRates;
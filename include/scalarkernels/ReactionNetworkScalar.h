@@ -0,0 +1,258 @@
+//* This file is part of Crane, an open-source
+//* application for plasma chemistry and thermochemistry
+//* https://github.com/lcpp-org/crane
+//*
+//* Crane is powered by the MOOSE Framework
+//* https://www.mooseframework.org
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "ScalarKernel.h"
+#include "ReactionNetworkCompiler.h"
+
+class RateExpressionEvaluator;
+
+/**
+ * Adds the source and sink terms of an entire scalar reaction network in a single object.
+ *
+ * Each reaction rate is evaluated once per residual (or Jacobian) evaluation and scattered into
+ * every species it affects through a sparse stoichiometry matrix. The residual and Jacobian blocks
+ * of all species are assembled here, so the `variable` parameter only names the first species.
+ *
+ * Rate coefficients are normally coupled aux variables. Alternatively, some of them can be taken
+ * from a RateExpressionEvaluator at the current nonlinear iterate, in which case their derivatives
+ * with respect to any nonlinear variables they depend on (e.g. temperatures) enter the Jacobian.
+ *
+ * Species fixed by a conservation law of the network may be left out of the nonlinear system and
+ * given as `conserved_species` aux variables. Each is reconstructed from the tracked species as
+ * N_e = N_e_old + sum_j c_j (N_j_old - N_j), and its dependence on them enters the Jacobian.
+ *
+ * Short-lived intermediates can likewise be given as `qss_species`. Their densities are not
+ * integrated but solved from the balance of their production and loss (quasi-steady-state
+ * approximation) at every evaluation, and their sensitivity to the tracked species enters the
+ * Jacobian through the implicit function theorem.
+ */
+class ReactionNetworkScalar : public ScalarKernel
+{
+public:
+  ReactionNetworkScalar(const InputParameters & parameters);
+
+  static InputParameters validParams();
+
+  virtual void computeResidual() override;
+  virtual void computeJacobian() override;
+
+  /// Variable numbers of the tracked species
+  const std::vector<unsigned int> & speciesVariables() const { return _species_var; }
+  bool useLog() const { return _use_log; }
+  /// Number of species reconstructed from conservation laws
+  unsigned int numConservedSpecies() const { return _num_conserved; }
+  /// Number of species in quasi-steady state
+  unsigned int numQuasiSteadySpecies() const { return _num_qss; }
+  /// Number of reactions evaluated by the residual since the last ranking (all without pruning)
+  unsigned int numActiveReactions() const { return _active.size(); }
+  /// Solves for the quasi-steady densities at the current solution and returns density q
+  Real quasiSteadyDensity(unsigned int q);
+
+  /**
+   * Adds the net production rate dN/dt of every tracked species to `rates`, for standalone ODE
+   * integration. `density` holds the (linear, even if use_log) densities of the tracked species.
+   * The untracked reactants and the rate coefficients keep their current values. If `jacobian`
+   * is not null, d(rate of species r)/d(density of species c) is added to jacobian[r * stride + c].
+   */
+  void addProductionRates(const Real * density,
+                          Real * rates,
+                          Real * jacobian = nullptr,
+                          unsigned int stride = 0) const;
+
+  /// Number of values written by frozenInputs()
+  unsigned int numFrozenInputs() const
+  {
+    return _num_reactions + _density.size() - _num_species + _num_conserved;
+  }
+  /**
+   * Writes the current rate coefficients, the (linear) densities of the untracked reactants and
+   * the conserved totals to inputs[0], inputs[stride], ...; these are held fixed by
+   * addProductionRates().
+   */
+  void frozenInputs(Real * inputs, unsigned int stride = 1) const;
+  /**
+   * addProductionRates() for an ensemble of independent copies of the network, stored
+   * member-fastest: inputs[j * members + m] holds frozen input j of member m, density and rates
+   * are indexed [species * members + m] and jacobian [(r * stride + c) * members + m].
+   */
+  void addEnsembleProductionRates(unsigned int members,
+                                  const Real * inputs,
+                                  const Real * density,
+                                  Real * rates,
+                                  Real * jacobian,
+                                  unsigned int stride) const;
+
+protected:
+  /// Evaluates the rate of every active reaction (and optionally d(rate)/d(reactant))
+  void computeRates(bool compute_derivatives);
+  /**
+   * At the first evaluation of a timestep, ranks all reactions if prune_interval timesteps have
+   * passed or a density has changed by more than prune_recheck_change since the last ranking. A
+   * reaction stays active if its rate exceeds prune_threshold times the larger of the production
+   * and consumption rates of some species it changes.
+   */
+  void updateActiveReactions();
+  /// Copies the rate coefficients and densities into contiguous buffers for the compiled network
+  void gatherCompiledInputs();
+  /// The rate coefficient of reaction i
+  Real rateCoefficient(unsigned int i) const;
+  /// The product of the reactant densities of reaction i (rate = k * factor)
+  Real reactantFactor(unsigned int i) const;
+  /// Adds d(residual)/d(variable) for the variables the evaluated rate coefficients depend on
+  void computeRateCoefficientJacobian();
+  /// Density m, counting the tracked species, the untracked reactants and the conserved species
+  Real density(unsigned int m) const
+  {
+    if (m < _density.size())
+      return (*_density[m])[0];
+    return m < _qss_begin ? _conserved_value[m - _density.size()] : _qss_value[m - _qss_begin];
+  }
+  /// N_e + sum_j c_j N_j of conserved species k, from the old values
+  Real conservedTotal(unsigned int k) const;
+  /// Reconstructs the conserved species from the current tracked densities
+  void updateConservedDensities();
+  /// Adds the Jacobian of the rates of reactions consuming conserved species
+  void computeConservedJacobian();
+  /**
+   * Solves the production = loss balance of the quasi-steady species for their densities, given
+   * rate coefficients k and densities n (indexed as reactants). The quasi-steady entries of n hold
+   * the initial guess and receive the solution. If `sensitivity` is not null, dQ_q/dN_j of every
+   * tracked species j is written to sensitivity[q * _num_species + j].
+   */
+  void solveQuasiSteady(const Real * k, Real * n, Real * sensitivity) const;
+  /// Solves for the quasi-steady densities at the current solution (and their sensitivities)
+  void updateQuasiSteadyDensities(bool compute_sensitivity);
+  /// Adds the Jacobian of the rates of reactions consuming quasi-steady species
+  void computeQuasiSteadyJacobian();
+
+  /// Whether the densities are stored as logarithms (N = exp(n))
+  const bool _use_log;
+
+  /// Number of tracked species (rows of the stoichiometry matrix)
+  const unsigned int _num_species;
+  /// Number of reactions (columns of the stoichiometry matrix)
+  const unsigned int _num_reactions;
+
+  /// Variable numbers of the tracked species
+  std::vector<unsigned int> _species_var;
+  /// Values of the tracked species followed by any untracked (aux) reactants
+  std::vector<const VariableValue *> _density;
+  /// Rate coefficient of each reaction
+  std::vector<const VariableValue *> _rate_coefficient;
+
+  /// Reactants of each reaction, stored as indices into _density (CSR layout)
+  std::vector<unsigned int> _reactant_offset;
+  std::vector<unsigned int> _reactant;
+
+  /// Nonzero stoichiometric coefficients of each reaction (CSR layout)
+  std::vector<unsigned int> _stoich_offset;
+  std::vector<unsigned int> _stoich_species;
+  std::vector<Real> _stoich_coeff;
+
+  /// Jacobian sparsity pattern as (species row, species column) pairs
+  std::vector<std::pair<unsigned int, unsigned int>> _jacobian_pattern;
+  /// For every (reaction, reactant, stoichiometric entry) triple, its slot in _jacobian_pattern
+  std::vector<unsigned int> _jacobian_slot;
+  /// Index in _jacobian_slot of the first triple of each reaction
+  std::vector<unsigned int> _jacobian_slot_offset;
+
+  /// Provider of rate coefficients evaluated at the current iterate (optional)
+  const RateExpressionEvaluator * _rate_provider;
+  /// Index of each reaction's rate in _rate_provider (-1 to use the coupled rate coefficient)
+  std::vector<int> _rate_expression_index;
+  /// Provider arguments that are variables of this system, and their variable numbers
+  std::vector<unsigned int> _rate_arg;
+  std::vector<unsigned int> _rate_arg_var;
+  /// Rate coefficient Jacobian as (species row, variable number) pairs, and the slot of every
+  /// (reaction, argument, stoichiometric entry) triple
+  std::vector<std::pair<unsigned int, unsigned int>> _rate_jacobian_pattern;
+  std::vector<unsigned int> _rate_jacobian_slot;
+  /// Index in _rate_jacobian_slot of the first triple of each reaction
+  std::vector<unsigned int> _rate_jacobian_slot_offset;
+  std::vector<Real> _rate_jacobian;
+
+  /// Species reconstructed from conservation laws, stored as reactants after the untracked ones
+  const unsigned int _num_conserved;
+  /// Coefficients c_j of each conserved species, stored row by row (one column per tracked species)
+  std::vector<Real> _conserved_coeff;
+  std::vector<const VariableValue *> _conserved_old;
+  std::vector<const VariableValue *> _species_old;
+  std::vector<Real> _conserved_value;
+  /// Jacobian of the rates through the conserved species as (species row, species column) pairs,
+  /// and the slot of every (reaction, reactant, coefficient, stoichiometric entry) combination
+  std::vector<std::pair<unsigned int, unsigned int>> _conserved_pattern;
+  std::vector<unsigned int> _conserved_slot;
+  /// Index in _conserved_slot of the first combination of each reaction
+  std::vector<unsigned int> _conserved_slot_offset;
+  std::vector<Real> _conserved_jacobian;
+
+  /// Species in quasi-steady state, stored as reactants after the conserved species
+  const unsigned int _num_qss;
+  unsigned int _qss_begin;
+  /// Net coefficient of each quasi-steady species in each reaction, stored reaction by reaction
+  std::vector<Real> _qss_coeff;
+  /// Reactions changing a quasi-steady species, and the tracked species among their reactants
+  std::vector<unsigned int> _qss_reactions;
+  std::vector<unsigned int> _qss_inputs;
+  const Real _qss_tolerance;
+  const unsigned int _qss_max_iterations;
+  std::vector<const VariableValue *> _qss_guess;
+  std::vector<Real> _qss_value;
+  std::vector<Real> _qss_sensitivity;
+  /// Jacobian of the rates through the quasi-steady species, laid out as for conserved species
+  std::vector<std::pair<unsigned int, unsigned int>> _qss_pattern;
+  std::vector<unsigned int> _qss_slot;
+  /// Index in _qss_slot of the first combination of each reaction
+  std::vector<unsigned int> _qss_slot_offset;
+  std::vector<Real> _qss_jacobian;
+  /// Work arrays of solveQuasiSteady()
+  mutable std::vector<Real> _qss_k;
+  mutable std::vector<Real> _qss_n;
+  mutable std::vector<Real> _qss_f;
+  mutable std::vector<Real> _qss_matrix;
+  mutable std::vector<unsigned int> _qss_pivot;
+  mutable std::vector<Real> _qss_column;
+  mutable std::vector<Real> _qss_member_sensitivity;
+
+  /// Reactions whose rates enter the residual and Jacobian (all unless pruned)
+  const Real _prune_threshold;
+  const unsigned int _prune_interval;
+  const Real _prune_recheck_change;
+  std::vector<unsigned int> _active;
+  /// Timestep of the last call to updateActiveReactions() and of the last ranking
+  int _prune_step;
+  int _ranked_step;
+  /// Linear densities of the tracked species at the last ranking
+  std::vector<Real> _ranked_density;
+
+  /// Timed sections of the residual and Jacobian evaluations
+  const PerfID _residual_timer;
+  const PerfID _jacobian_timer;
+
+  /// Compiled residual and Jacobian of this network (if compile_network = true)
+  std::unique_ptr<ReactionNetworkCompiler> _compiled;
+  std::vector<Real> _k_buffer;
+  std::vector<Real> _n_buffer;
+
+  /// Work arrays, sized once in the constructor
+  std::vector<Real> _rate;
+  std::vector<Real> _rate_derivative;
+  std::vector<Real> _residual;
+  std::vector<Real> _jacobian;
+  /// Work arrays of addProductionRates() and addEnsembleProductionRates()
+  mutable std::vector<Real> _ode_inputs;
+  mutable std::vector<Real> _ode_rate;
+  mutable std::vector<Real> _ode_factor;
+  mutable std::vector<Real> _ode_conserved;
+  mutable std::vector<Real> _ode_qss;
+  mutable std::vector<Real> _ode_qss_sensitivity;
+};
@@ -12,6 +12,11 @@
 
 #include "GeneralUserObject.h"
 #include "SplineInterpolation.h"
+#include "TwoTermBoltzmannSolver.h"
+#include "EEDFSolutionCache.h"
+#include "EEDFTable.h"
+
+#include <future>
 
 // class Function;
 
@@ -19,6 +24,7 @@ class BoltzmannSolverScalar : public GeneralUserObject
 {
 public:
   BoltzmannSolverScalar(const InputParameters & parameters);
+  ~BoltzmannSolverScalar();
   static InputParameters validParams();
 
   Real test(const int i) const;
@@ -35,10 +41,67 @@ public:
   virtual void finalize();
 
 protected:
+  /// Inputs and results of one Boltzmann solve
+  struct Solve
+  {
+    std::vector<Real> mole_fractions;
+    /// Reduced field in Td
+    Real reduced_field;
+    Real neutral_density;
+    Real ionization_degree;
+    /// Text of the Bolsig+ input file (solver = bolsig)
+    std::string input;
+    /// Key of the solve in the solution cache
+    std::string key;
+    std::vector<Real> x;
+    std::vector<std::vector<Real>> rate_coefficient;
+    std::vector<Real> electron_temperature;
+    std::vector<Real> electron_mobility;
+    /// Whether the solver ran (rather than the results being taken from the cache)
+    bool solved = false;
+    /// Why the solve failed, if it did
+    std::string error;
+  };
+
+  /// Sets up the native or table solver and sizes the results
+  void setupInProcessSolver();
+  /// Reads the cross sections and matches each reaction to a process (solver = native)
+  void setupNativeSolver(const std::vector<std::string> & species);
+  /// Reads the table and matches its axes and columns to the inputs and results (solver = table)
+  void setupTableSolver(const std::vector<std::string> & species);
+  /// Creates the solution cache (if cache_tolerance > 0)
+  void setupCache();
+  /// Records the current state (and the Bolsig+ input) for a solve
+  Solve prepareSolve();
+  /**
+   * Runs a solve. Only uses the solver state of this object, so it can run on another thread.
+   * Errors are recorded in the solve rather than raised, and raised by applySolve.
+   */
+  void computeSolve(Solve & solve);
+  /// Takes the results from the cache or runs the solver, throwing on failure
+  void computeSolveResults(Solve & solve);
+  void solveNative(Solve & solve);
+  void solveTable(Solve & solve);
+  void solveBolsig(Solve & solve);
+  /// Makes the results of a solve the current results, or raises its error
+  void applySolve(Solve & solve);
+  /// Starts a solve in the background, and takes its results (waiting if needed)
+  void launchSolve();
+  void collectSolve();
+  /// Replaces a line (numbered from 1) of the Bolsig+ input held in memory
+  void setInputLine(unsigned int line, const std::string & text);
+  /// Writes the Bolsig+ input file in one operation
+  void writeInput(const std::string & text) const;
+  /// Reads the Bolsig+ output file into memory, indexing it on the first call
+  void readOutput();
+  /// Finds the lines of every result in the output file
+  void indexOutput();
+  /// Reads x y pairs starting at a line (numbered from 1) of the output, one per entry of y
+  void readOutputPairs(int line, std::vector<Real> & x, std::vector<Real> & y) const;
+
   std::string _file_name;
   std::size_t _nargs;
   std::vector<const VariableValue *> _args;
-  std::vector<std::stringstream> _fractions_string;
   std::string _cross_sections;
   const VariableValue & _reduced_field;
   const VariableValue & _plasma_density;
@@ -62,12 +125,56 @@ protected:
   int _diffusivity_line;
   int _temperature_line;
   unsigned int _timestep_number;
-  std::stringstream _field_string;
   std::vector<Real> _electron_mobility;
   std::vector<Real> _electron_temperature;
   int _table_number;
-  Real _tempstore;
   std::vector<SplineInterpolation> _coefficient_interpolation;
   SplineInterpolation _temperature_interpolation;
   SplineInterpolation _mobility_interpolation;
+
+  /// Lines of the Bolsig+ input file
+  std::vector<std::string> _input_lines;
+  /// Text of the last Bolsig+ output and the offset of each of its lines
+  std::string _output_text;
+  std::vector<std::size_t> _output_line_offset;
+  /// Whether the result lines of the output file have been found
+  bool _output_indexed;
+
+  /// The external Bolsig+ executable, the in-process two-term solver or a precomputed table
+  enum class Solver
+  {
+    Bolsig,
+    Native,
+    Table
+  };
+  const Solver _solver;
+  std::unique_ptr<TwoTermBoltzmannSolver> _boltzmann;
+  /// Solver process of each reaction
+  std::vector<unsigned int> _process;
+  /// Reduced fields (Td) at which the native or table solver tabulates its results
+  std::vector<Real> _table_field;
+  /// Precomputed table (solver = table), the input of each of its axes (a species index, -1 for
+  /// the reduced field or -2 for the ionization degree) and the columns of the results
+  std::unique_ptr<EEDFTable> _eedf_table;
+  std::vector<int> _table_axis_input;
+  std::vector<unsigned int> _table_column;
+  unsigned int _mean_energy_column;
+  unsigned int _mobility_column;
+
+  /// Memoized solutions, keyed by the settings they were computed with
+  std::unique_ptr<EEDFSolutionCache> _cache;
+
+  /// Whether solves after the first run in the background
+  const bool _asynchronous;
+  /// Number of executions after which the results of a background solve are taken
+  const unsigned int _max_lag;
+  /// The background solve, and the number of executions since it started
+  std::future<Solve> _pending;
+  unsigned int _pending_steps;
+  /// Whether a solve has finished, so that results are available
+  bool _has_results;
+
+  /// Timed sections of synchronous solves and of waiting for background solves
+  const PerfID _solve_timer;
+  const PerfID _wait_timer;
 };
@@ -0,0 +1,31 @@
+//* This file is part of Crane, an open-source
+//* application for plasma chemistry and thermochemistry
+//* https://github.com/lcpp-org/crane
+//*
+//* Crane is powered by the MOOSE Framework
+//* https://www.mooseframework.org
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+
+#pragma once
+
+#include "GeneralUserObject.h"
+
+/**
+ * Prints the chemistry event counters (see ChemistryCounters), summed over all processes, as a
+ * table at the end of the run. Timings of the instrumented objects are in the performance graph
+ * (perf_graph = true in [Outputs]).
+ */
+class ChemistryCounterSummary : public GeneralUserObject
+{
+public:
+  ChemistryCounterSummary(const InputParameters & parameters);
+
+  static InputParameters validParams();
+
+  virtual void initialize() override {}
+  virtual void execute() override;
+  virtual void finalize() override {}
+};
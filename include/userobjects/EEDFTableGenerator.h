@@ -0,0 +1,59 @@
+//* This file is part of Crane, an open-source
+//* application for plasma chemistry and thermochemistry
+//* https://github.com/lcpp-org/crane
+//*
+//* Crane is powered by the MOOSE Framework
+//* https://www.mooseframework.org
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "GeneralUserObject.h"
+
+class EEDFTable;
+
+/**
+ * Tabulates the results of the two-term Boltzmann solver (rate coefficients, mean energy and
+ * reduced mobility) on a grid of up to two varied mole fractions and the reduced field, and writes
+ * them to a table file that BoltzmannSolverScalar can read with solver = table.
+ *
+ * The grid points are divided between the MPI ranks and, within each rank, between threads. Each
+ * thread sweeps a contiguous block of points with its own solver, so consecutive solves start
+ * from similar solutions.
+ */
+class EEDFTableGenerator : public GeneralUserObject
+{
+public:
+  EEDFTableGenerator(const InputParameters & parameters);
+
+  static InputParameters validParams();
+
+  virtual void initialize() override {}
+  virtual void execute() override;
+  virtual void finalize() override {}
+
+protected:
+  /// Solves for the grid points [begin, end) of the table
+  void solveRange(EEDFTable & table, unsigned int begin, unsigned int end) const;
+  /// Mole fractions of all species at the given varied mole fractions
+  std::vector<Real> moleFractions(const std::vector<Real> & varied) const;
+
+  const std::string _cross_sections;
+  const std::vector<std::string> & _species;
+  const std::vector<Real> & _mole_fractions;
+  const std::vector<std::string> & _reaction_species;
+  const std::vector<std::string> & _reaction_type;
+  /// Solver process index of each reaction
+  std::vector<unsigned int> _process;
+  const std::vector<Real> & _reduced_field;
+  /// Indices in _species of the varied species, and their mole fraction values
+  std::vector<unsigned int> _varied;
+  std::vector<std::vector<Real>> _varied_fractions;
+  const Real _gas_temperature;
+  const unsigned int _energy_cells;
+  const unsigned int _num_threads;
+  const std::string _table_file;
+  bool _generated;
+};
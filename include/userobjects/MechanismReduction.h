@@ -0,0 +1,88 @@
+//* This file is part of Crane, an open-source
+//* application for plasma chemistry and thermochemistry
+//* https://github.com/lcpp-org/crane
+//*
+//* Crane is powered by the MOOSE Framework
+//* https://www.mooseframework.org
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "GeneralUserObject.h"
+#include "ScalarNetworkRates.h"
+
+/**
+ * Reduces a reaction network with the directed relation graph (DRG) of Lu and Law, Proc. Combust.
+ * Inst. 30 (2005) 1333, or its error propagation variant (DRGEP) of Pepiot-Desjardins and Pitsch,
+ * Combust. Flame 154 (2008) 67.
+ *
+ * Every execution samples the current state of a reference run: the reaction rates follow from
+ * the coupled rate coefficients and densities. The graph has one node per species, and the edge
+ * from A to B weighs how much the production or consumption of A depends on reactions involving
+ * B. Species that remain important to one of the targets in any sample are retained, along with
+ * the reactions among them. On FINAL, the retained species and reactions are written as a
+ * `species` and `reactions` block that can replace the original one in the input.
+ */
+class MechanismReduction : public GeneralUserObject
+{
+public:
+  enum class Method
+  {
+    DRG,
+    DRGEP
+  };
+
+  MechanismReduction(const InputParameters & parameters);
+
+  static InputParameters validParams();
+
+  virtual void initialize() override {}
+  virtual void execute() override;
+  virtual void finalize() override;
+
+  /// Largest importance of species j to the targets over the samples so far
+  Real importance(unsigned int j) const { return _importance[j]; }
+  /// Whether species j is retained
+  bool retained(unsigned int j) const;
+
+protected:
+  /// Fills _weight with the edge weights r_AB of the current state; returns false if nothing reacts
+  bool computeEdgeWeights();
+  /// Importance of every species in the current state, maximized into _importance
+  void updateImportance();
+  /// Writes the retained species and reactions to _file_name
+  void writeMechanism() const;
+
+  const Method _method;
+  const Real _threshold;
+  const std::string _file_name;
+
+  const unsigned int _num_species;
+  const unsigned int _num_reactions;
+  const std::vector<VariableName> & _species_names;
+  std::unique_ptr<ScalarNetworkRates> _rates;
+  /// Reactants of each reaction, as indices into 'species' followed by 'args'
+  const std::vector<std::vector<unsigned int>> & _reactants;
+  /// Species changed by each reaction and their net stoichiometric coefficients
+  const std::vector<std::vector<unsigned int>> & _stoich_species;
+  const std::vector<std::vector<Real>> & _stoich_coeff;
+  /// Species taking part in each reaction (reactants and changed species)
+  std::vector<std::vector<unsigned int>> _participants;
+
+  /// Input text of every reaction line, and the line of each reaction
+  const std::vector<std::string> & _lines;
+  const std::vector<unsigned int> & _reaction_line;
+
+  std::vector<unsigned int> _targets;
+  /// Edge weights r_AB, stored row by row
+  std::vector<Real> _weight;
+  std::vector<Real> _importance;
+  unsigned int _num_samples;
+
+  /// Work arrays
+  std::vector<Real> _rate;
+  std::vector<Real> _denominator;
+  std::vector<Real> _path;
+};
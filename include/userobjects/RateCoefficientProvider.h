@@ -34,7 +34,7 @@ public:
   virtual void finalize();
 
 protected:
-  SplineInterpolation _coefficient_interpolation;
+  std::shared_ptr<const SplineInterpolation> _coefficient_interpolation;
   Real _rate_constant;
 
   std::string _sampling_format;
@@ -0,0 +1,56 @@
+//* This file is part of Crane, an open-source
+//* application for plasma chemistry and thermochemistry
+//* https://github.com/lcpp-org/crane
+//*
+//* Crane is powered by the MOOSE Framework
+//* https://www.mooseframework.org
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "GeneralUserObject.h"
+#include "RateExpressionTape.h"
+
+/**
+ * Parses every equation-based rate coefficient of a scalar network together and evaluates them
+ * in one pass, sharing common subexpressions between reactions (see RateExpressionTape).
+ *
+ * Evaluation is lazy: the first value() call after any of the coupled variables has changed
+ * re-evaluates the whole set. This keeps the results consistent with aux scalar kernels that
+ * update those variables on the same execute flag, and lets kernels query rates and their
+ * derivatives at the current nonlinear iterate.
+ */
+class RateExpressionEvaluator : public GeneralUserObject
+{
+public:
+  RateExpressionEvaluator(const InputParameters & parameters);
+
+  static InputParameters validParams();
+
+  /// The value of rate expression i
+  Real value(unsigned int i) const;
+  /// The derivative of rate expression i with respect to the j-th variable in 'args'
+  Real derivative(unsigned int i, unsigned int j) const;
+
+  /// The variables in 'args', in order
+  const std::vector<const MooseVariableScalar *> & argVariables() const { return _arg_vars; }
+
+  virtual void initialize() override {}
+  virtual void execute() override {}
+  virtual void finalize() override {}
+
+protected:
+  /// Re-evaluates the expressions if the coupled variables have changed since the last call
+  void update(bool compute_derivatives) const;
+
+  std::vector<const MooseVariableScalar *> _arg_vars;
+  std::vector<const VariableValue *> _args;
+
+  /// The tape, and the variable values it was last evaluated with
+  mutable RateExpressionTape _tape;
+  mutable std::vector<Real> _arg_values;
+  mutable bool _evaluated;
+  mutable bool _evaluated_derivatives;
+};
@@ -0,0 +1,103 @@
+//* This file is part of Crane, an open-source
+//* application for plasma chemistry and thermochemistry
+//* https://github.com/lcpp-org/crane
+//*
+//* Crane is powered by the MOOSE Framework
+//* https://www.mooseframework.org
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "ElementUserObject.h"
+
+#include <unordered_map>
+
+/**
+ * Integrates the source terms of a reaction network at every mesh node, separately from the
+ * transport solve (operator splitting).
+ *
+ * The species are nodal (first order LAGRANGE) variables. While executing, the rate coefficients
+ * and the untracked reactants are projected onto the nodes with a lumped L2 projection of their
+ * quadrature point values. On finalize, each node owned by this process integrates
+ * dN/dt = S r(N) with these inputs held fixed, using an adaptive Rosenbrock method on the analytic
+ * Jacobian, and the new densities are written into the solution. Nodes are divided between
+ * num_threads threads.
+ *
+ * With Lie splitting the object runs on TIMESTEP_END and integrates over dt after the transport
+ * solve. With Strang splitting it also runs on TIMESTEP_BEGIN, and each run covers dt/2; the
+ * first half updates the old solution as well, so that the transport step starts from it.
+ */
+class ReactionNetworkSplit : public ElementUserObject
+{
+public:
+  ReactionNetworkSplit(const InputParameters & parameters);
+
+  static InputParameters validParams();
+
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual void threadJoin(const UserObject & y) override;
+  virtual void finalize() override;
+
+protected:
+  /// Sends the sums of nodes owned by other processes to their owners
+  void gatherNodeSums();
+  /// Integrates the nodes [begin, end) of `nodes` over dt; `inputs` and `state` are stored node
+  /// by node. Returns false if an integration failed.
+  bool integrateNodes(const std::vector<dof_id_type> & nodes,
+                      unsigned int begin,
+                      unsigned int end,
+                      const std::vector<Real> & inputs,
+                      std::vector<Real> & state,
+                      std::vector<Real> & substep,
+                      Real dt) const;
+  /// dN/dt (and optionally its Jacobian) at the given rate coefficients and untracked reactants
+  void productionRates(const Real * inputs,
+                       const std::vector<Real> & density,
+                       std::vector<Real> & rates,
+                       Real * jacobian) const;
+
+  enum class Splitting
+  {
+    Lie,
+    Strang
+  };
+  const Splitting _splitting;
+  const bool _use_log;
+  const unsigned int _num_species;
+  const unsigned int _num_reactions;
+  const Real _relative_tolerance;
+  const Real _absolute_tolerance;
+  const unsigned int _max_substeps;
+  const unsigned int _num_threads;
+
+  std::vector<MooseVariable *> _species;
+  /// Untracked reactants, read at the quadrature points
+  std::vector<const VariableValue *> _aux_reactant;
+  std::vector<const MaterialProperty<Real> *> _rate_coefficient;
+  /// Shape functions of the species
+  const VariablePhiValue & _phi;
+
+  /// Reactants of each reaction as indices into the species followed by the untracked reactants
+  /// (CSR layout)
+  std::vector<unsigned int> _reactant_offset;
+  std::vector<unsigned int> _reactant;
+  /// Nonzero stoichiometric coefficients of each reaction (CSR layout)
+  std::vector<unsigned int> _stoich_offset;
+  std::vector<unsigned int> _stoich_species;
+  std::vector<Real> _stoich_coeff;
+
+  /// Per node: the lumped mass, then the integrals of phi times each rate coefficient and each
+  /// untracked reactant density
+  std::unordered_map<dof_id_type, std::vector<Real>> _node_sums;
+  /// Last substep size of each node, carried between steps
+  std::unordered_map<dof_id_type, Real> _node_substep;
+  /// Densities before the last TIMESTEP_BEGIN half step, to start from if the step is repeated
+  std::unordered_map<dof_id_type, std::vector<Real>> _begin_state;
+  int _begin_step;
+
+  /// Timed section of the chemistry integration
+  const PerfID _integrate_timer;
+};
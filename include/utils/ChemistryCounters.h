@@ -0,0 +1,76 @@
+//* This file is part of Crane, an open-source
+//* application for plasma chemistry and thermochemistry
+//* https://github.com/lcpp-org/crane
+//*
+//* Crane is powered by the MOOSE Framework
+//* https://www.mooseframework.org
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+
+#pragma once
+
+#include "MooseTypes.h"
+
+#include <string>
+#include <vector>
+
+class MooseApp;
+
+/**
+ * Process-wide event counters of the chemistry hot paths (rate evaluations, table lookups,
+ * Boltzmann solver runs, network residual and Jacobian evaluations), reported at the end of a run
+ * by ChemistryCounterSummary.
+ *
+ * Each thread increments its own cache-line-sized slot, so counting from threaded materials needs
+ * no synchronization. The slots are sized once by CraneApp, before any threads are started.
+ */
+class ChemistryCounters
+{
+public:
+  enum Counter
+  {
+    RateEvaluations,
+    TableLookups,
+    OutOfRangeLookups,
+    BoltzmannSolves,
+    NetworkResiduals,
+    NetworkJacobians,
+    NumCounters
+  };
+
+  /// Provides a slot for each of n threads (keeping the counts so far)
+  static void reserve(THREAD_ID n);
+
+  /// Adds n events of counter c on thread tid
+  static void add(Counter c, THREAD_ID tid, unsigned long long n = 1)
+  {
+    _counts[tid].value[c] += n;
+  }
+
+  /// Sum of counter c over all threads of this process
+  static unsigned long long total(Counter c);
+  /// Description of counter c, for reports
+  static std::string name(Counter c);
+
+  /**
+   * Registers a timed section of the performance graph of `app` and returns its id, to be used
+   * with PerfGuard. Sections at `level` and below are shown by perf_graph = true (levels above 2
+   * are only shown at higher output levels).
+   */
+  static PerfID
+  registerSection(MooseApp & app, const std::string & section, unsigned int level);
+
+protected:
+  struct alignas(64) Slot
+  {
+    unsigned long long value[NumCounters] = {};
+  };
+
+  /**
+   * The counts of each thread. They are static, so every app in the process adds to them: the
+   * events of MultiApp sub-apps run in this process are included in the totals of the parent.
+   */
+  static std::vector<Slot> _counts;
+};
@@ -0,0 +1,22 @@
+//* This file is part of Crane, an open-source
+//* application for plasma chemistry and thermochemistry
+//* https://github.com/lcpp-org/crane
+//*
+//* Crane is powered by the MOOSE Framework
+//* https://www.mooseframework.org
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include <string>
+
+namespace ContentHash
+{
+/**
+ * 64-bit FNV-1a hash of text as 16 hex digits. The value is stable across runs and platforms, so
+ * it can name files in on-disk caches and key tables shared between objects.
+ */
+std::string hash(const std::string & text);
+}
@@ -0,0 +1,69 @@
+//* This file is part of Crane, an open-source
+//* application for plasma chemistry and thermochemistry
+//* https://github.com/lcpp-org/crane
+//*
+//* Crane is powered by the MOOSE Framework
+//* https://www.mooseframework.org
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseTypes.h"
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Memoizes the results of Boltzmann solves under a key built from their quantized inputs.
+ *
+ * Each input is rounded to a bucket of relative width `tolerance` on a logarithmic scale, so two
+ * inputs in the same bucket differ by at most `tolerance` relative to each other (values of
+ * magnitude below 1e-30 all share the zero bucket). The key also contains a context string, which
+ * should identify everything else the results depend on (cross sections, solver settings, ...).
+ * The context is hashed once, when the cache is created.
+ *
+ * Entries can be persisted in a text file with one entry per line, which is read when the cache is
+ * created and appended to as new results are inserted. Lines that cannot be read are skipped. The
+ * cache is not synchronized; at most one thread may use it at a time.
+ */
+class EEDFSolutionCache
+{
+public:
+  /**
+   * Creates a cache for the given relative tolerance and context. If `file_name` is not empty, its
+   * entries are loaded and, if `write` is true, new entries are appended to it.
+   */
+  EEDFSolutionCache(Real tolerance,
+                    const std::string & context,
+                    const std::string & file_name = "",
+                    bool write = true);
+
+  /// The key of a set of inputs
+  std::string key(const std::vector<Real> & inputs) const;
+
+  /// The stored values of a key (or nullptr), counting hits and misses
+  const std::vector<Real> * find(const std::string & key);
+  /// Stores values under a key, replacing any earlier values. Throws if writing the file fails.
+  void insert(const std::string & key, const std::vector<Real> & values);
+
+  std::size_t size() const { return _entries.size(); }
+  unsigned int hits() const { return _hits; }
+  unsigned int misses() const { return _misses; }
+
+protected:
+  /// Reads the entries of the cache file, if it exists
+  void load();
+
+  /// Width of a bucket in ln|x|
+  const Real _log_width;
+  /// Hash of the context, which starts every key
+  const std::string _context_hash;
+  const std::string _file_name;
+  const bool _write;
+  std::unordered_map<std::string, std::vector<Real>> _entries;
+  unsigned int _hits;
+  unsigned int _misses;
+};
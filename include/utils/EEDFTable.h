@@ -0,0 +1,70 @@
+//* This file is part of Crane, an open-source
+//* application for plasma chemistry and thermochemistry
+//* https://github.com/lcpp-org/crane
+//*
+//* Crane is powered by the MOOSE Framework
+//* https://www.mooseframework.org
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseTypes.h"
+
+#include <string>
+#include <vector>
+
+/**
+ * Results of Boltzmann solves tabulated on a rectilinear grid of any number of named axes (e.g.
+ * the reduced field and some mole fractions), with any number of named columns per grid point.
+ *
+ * Points are stored in row-major order (the last axis varies fastest), with the columns of each
+ * point adjacent. Lookups interpolate multilinearly and hold the end values beyond each axis.
+ *
+ * The text format starts with one line per axis, "axis <name> <n> <n values>", followed by
+ * "columns <m> <m names>" and then one line of m values per grid point. Lines starting with # are
+ * comments. Names cannot contain whitespace.
+ */
+class EEDFTable
+{
+public:
+  /// Reads a table file
+  explicit EEDFTable(const std::string & file_name);
+  /// Creates an empty (zero) table
+  EEDFTable(const std::vector<std::string> & axis_names,
+            const std::vector<std::vector<Real>> & axes,
+            const std::vector<std::string> & columns);
+
+  void write(const std::string & file_name) const;
+
+  unsigned int numAxes() const { return _axes.size(); }
+  unsigned int numColumns() const { return _columns.size(); }
+  unsigned int numPoints() const { return _values.size() / _columns.size(); }
+  /// Index of the named axis or column, or -1
+  int axisIndex(const std::string & name) const;
+  int columnIndex(const std::string & name) const;
+  const std::string & axisName(unsigned int a) const { return _axis_names[a]; }
+
+  /// Coordinates of grid point p
+  std::vector<Real> point(unsigned int p) const;
+  /// The columns of grid point p
+  Real * values(unsigned int p) { return &_values[p * _columns.size()]; }
+  /// All values, point by point
+  std::vector<Real> & values() { return _values; }
+
+  /// Interpolates every column at x (one coordinate per axis)
+  void sample(const std::vector<Real> & x, std::vector<Real> & values) const;
+
+  /// Name of the column holding the rate coefficient of a reaction, e.g. "k:N2:Excitation_11.03_eV"
+  static std::string rateColumn(const std::string & species, const std::string & type);
+
+protected:
+  /// Checks that the axes are increasing and sizes the values
+  void initialize();
+
+  std::vector<std::string> _axis_names;
+  std::vector<std::vector<Real>> _axes;
+  std::vector<std::string> _columns;
+  std::vector<Real> _values;
+};
@@ -0,0 +1,149 @@
+//* This file is part of Crane, an open-source
+//* application for plasma chemistry and thermochemistry
+//* https://github.com/lcpp-org/crane
+//*
+//* Crane is powered by the MOOSE Framework
+//* https://www.mooseframework.org
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseTypes.h"
+#include "InputParameters.h"
+#include "RateTableRegistry.h"
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <vector>
+
+class MooseObject;
+
+/**
+ * Interpolates many tabulated coefficients (e.g. the EEDF rate coefficients of a whole network) at
+ * the same sample point.
+ *
+ * Tables are grouped by their x grid. Rate tables produced by one Boltzmann solver run share the
+ * same E/N or mean energy grid, so a network usually forms a single group. Each group stores its
+ * columns interleaved point by point, so a sample costs one interval search per group followed by
+ * a contiguous loop over the columns that computes every value and derivative.
+ *
+ * Results match SplineInterpolation (natural cubic spline) and LinearInterpolation column by
+ * column. The interval search starts from the interval of the previous sample, which is usually
+ * still correct since samplers change little between calls. A table may also be resampled onto a
+ * uniform or log-uniform grid (see resample()), which turns the search into an index computation.
+ *
+ * A single table is a valid use. The grid data (columns, spline second derivatives and resampled
+ * nodes) is immutable and shared process-wide by every instance built from the same tables, so
+ * per-object and per-thread instances are cheap. Because of the cached search position, an
+ * instance should not be shared between threads.
+ *
+ * Objects that sample tables add validParams() to their own parameters and pass themselves to
+ * resample(const MooseObject &).
+ */
+class MultiRateTable
+{
+public:
+  enum class Interpolation
+  {
+    Linear,
+    Spline
+  };
+
+  /// The resample_grid and resample_tolerance parameters
+  static InputParameters validParams();
+
+  /**
+   * Reads each file through RateTableRegistry. With linear interpolation, `extrapolate` continues
+   * the first and last segments beyond the table; otherwise the end values are held. Splines
+   * always continue their end polynomials. `sort` orders each table by x.
+   */
+  MultiRateTable(const std::vector<std::string> & file_names,
+                 Interpolation type,
+                 bool extrapolate = false,
+                 bool sort = false);
+
+  /**
+   * Resamples every grid onto equally spaced points in x (or in ln x if `logarithmic`), doubling
+   * the number of points until the resampled values agree with the original interpolation to
+   * within `tolerance` times the largest magnitude in each column. Splines are resampled as cubic
+   * Hermite segments, linear tables as linear segments. Samples outside the original table still
+   * use the original end intervals. Returns false, leaving a grid unchanged, if `max_points` is not
+   * enough or a logarithmic grid has x <= 0.
+   */
+  bool resample(bool logarithmic, Real tolerance, unsigned int max_points = 65536);
+  /// Resamples as set by the resample_grid and resample_tolerance parameters of object, warning
+  /// through object if a grid could not be resampled
+  void resample(const MooseObject & object);
+
+  /// Writes the value and derivative of every table at x, in the order of the file names
+  void sample(Real x, Real * values, Real * derivatives) const;
+
+  /// Whether x lies within the x range of every table (otherwise sample() extrapolates or holds)
+  bool inRange(Real x) const;
+
+  unsigned int numTables() const { return _num_tables; }
+  /// Number of distinct x grids (interval searches per sample)
+  unsigned int numGrids() const { return _grids.size(); }
+
+protected:
+  struct Grid
+  {
+    std::vector<Real> x;
+    /// Output index of each column
+    std::vector<unsigned int> column;
+    /// y (and spline second derivatives) of all columns, stored point by point
+    std::vector<Real> y;
+    std::vector<Real> y2;
+
+    /// Resampled grid, with nodes u0 + j/inv_du in u = x or u = ln(x)
+    bool resampled = false;
+    bool logarithmic = false;
+    Real u0 = 0;
+    Real inv_du = 0;
+    unsigned int cells = 0;
+    /// Node values and, for splines, node derivatives dy/du * du, stored point by point
+    std::vector<Real> ry;
+    std::vector<Real> rdy;
+
+    /// Resampled copies of this grid keyed by the resample() arguments (null if it failed).
+    /// Requires _mutex.
+    mutable std::map<std::tuple<bool, Real, unsigned int>, std::shared_ptr<const Grid>>
+        resamplings;
+  };
+
+  /**
+   * Identifies a grid by its interpolation type, its tables and their output indices. The
+   * registry never releases a table, so its address identifies its contents.
+   */
+  typedef std::tuple<Interpolation,
+                     std::vector<const RateTableRegistry::Table *>,
+                     std::vector<unsigned int>>
+      GridKey;
+
+  /// Computes the natural spline second derivatives of every column of a grid
+  static void computeSecondDerivatives(Grid & grid);
+  /// Interval of the original grid containing x, searched from (and stored in) last
+  static unsigned int findInterval(const Grid & grid, Real x, unsigned int & last);
+  /// Evaluates all columns of a grid on the original interval lo
+  void sampleOriginal(
+      const Grid & grid, unsigned int lo, Real x, Real * values, Real * derivatives) const;
+  /// Evaluates all columns of a grid from its resampled nodes
+  void sampleResampled(const Grid & grid, Real x, Real * values, Real * derivatives) const;
+  /// Resamples one grid with the given number of cells; returns false if out of tolerance
+  bool resampleGrid(Grid & grid, bool logarithmic, unsigned int cells, Real tolerance) const;
+
+  const Interpolation _type;
+  const bool _extrapolate;
+  const unsigned int _num_tables;
+  std::vector<std::shared_ptr<const Grid>> _grids;
+  /// Interval used by the previous sample of each grid
+  mutable std::vector<unsigned int> _last;
+
+  static std::mutex _mutex;
+  static std::map<GridKey, std::shared_ptr<const Grid>> _cache;
+};
@@ -0,0 +1,199 @@
+//* This file is part of Crane, an open-source
+//* application for plasma chemistry and thermochemistry
+//* https://github.com/lcpp-org/crane
+//*
+//* Crane is powered by the MOOSE Framework
+//* https://www.mooseframework.org
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseTypes.h"
+
+#include <map>
+#include <string>
+#include <tuple>
+#include <vector>
+
+/**
+ * Parses a set of rate expressions into one shared expression graph and evaluates all of them in
+ * a single pass over a flat instruction tape.
+ *
+ * Identical subexpressions are stored once (hash-consing), so a term such as exp(-11490/Tgas) or
+ * Te^(-0.5) that appears in many rates is computed once per evaluation. Constant subexpressions are
+ * folded at parse time, and non-integer constant powers are rewritten as exp(c*log(x)) so that all
+ * powers of the same base share one logarithm.
+ *
+ * Expressions of modified Arrhenius form, A * T^n * exp(-E/T) for a single variable T (in any
+ * algebraically equivalent arrangement), are recognized structurally. They are evaluated separately
+ * from the tape as exp(lnA + n*lnT - E/T) over contiguous (lnA, n, E) arrays grouped by variable,
+ * together with the analytic derivative dk/dT.
+ *
+ * Derivatives of every expression with respect to every variable can be computed in the same pass
+ * (forward mode over the tape).
+ *
+ * The accepted syntax is the arithmetic subset of FParser: numbers, variables, named constants,
+ * + - * / ^, parentheses and the functions exp, log, log2, log10, sqrt, cbrt, abs, sin, cos, tan,
+ * sinh, cosh, tanh, atan, pow, min and max.
+ */
+class RateExpressionTape
+{
+public:
+  RateExpressionTape(const std::vector<std::string> & variables);
+
+  /**
+   * Defines a named constant from an expression of previously defined constants. Returns false with
+   * a message in error() if the expression could not be parsed or is not constant.
+   */
+  bool addConstant(const std::string & name, const std::string & expression);
+
+  /**
+   * Parses an expression and appends it to the outputs. Returns false with a message in error() if
+   * the expression could not be parsed.
+   */
+  bool addExpression(const std::string & expression);
+
+  /**
+   * Separates the Arrhenius expressions from the tape and removes operations that no remaining
+   * expression needs. Must be called once, after the last addExpression() and before evaluate().
+   */
+  void finalize();
+
+  /**
+   * Evaluates every expression for the given variable values (ordered as in the constructor) and,
+   * optionally, the derivatives with respect to each variable.
+   */
+  void evaluate(const std::vector<Real> & variables, bool compute_derivatives = false);
+
+  /// Value of expression i from the last call to evaluate()
+  Real value(unsigned int i) const { return _values[_outputs[i]]; }
+  /// Derivative of expression i with respect to variable v from the last call to evaluate()
+  Real derivative(unsigned int i, unsigned int v) const
+  {
+    return _derivatives[_outputs[i] * _variable_names.size() + v];
+  }
+
+  /// Whether expression i was recognized as A * T^n * exp(-E/T)
+  bool isArrhenius(unsigned int i) const { return _output_arrhenius[i] >= 0; }
+
+  unsigned int numExpressions() const { return _outputs.size(); }
+  unsigned int numArrhenius() const { return _arr_root.size(); }
+  /// Number of tape operations executed per evaluation, after sharing and constant folding
+  unsigned int numOperations() const { return _tape.size(); }
+
+  const std::string & error() const { return _error; }
+
+protected:
+  enum class Op
+  {
+    Constant,
+    Variable,
+    Add,
+    Sub,
+    Mul,
+    Div,
+    Pow,
+    Neg,
+    Exp,
+    Log,
+    Log2,
+    Log10,
+    Sqrt,
+    Cbrt,
+    Abs,
+    Sin,
+    Cos,
+    Tan,
+    Sinh,
+    Cosh,
+    Tanh,
+    Atan,
+    Min,
+    Max
+  };
+
+  struct Instruction
+  {
+    Op op;
+    unsigned int a;
+    unsigned int b;
+    unsigned int result;
+  };
+
+  /// Coefficients of lnA + n*ln(T) - E/T, where T is variable `var` (-1 if T does not appear)
+  struct Arrhenius
+  {
+    Real lnA;
+    Real n;
+    Real E;
+    int var;
+  };
+
+  /// Applies a single operation; shared by constant folding and evaluation
+  static Real apply(Op op, Real a, Real b);
+  /// Partial derivatives of r = op(a, b) with respect to a and b
+  static void partials(Op op, Real a, Real b, Real r, Real & dr_da, Real & dr_db);
+
+  /// Returns the node for the given operation, reusing an identical node if one exists
+  unsigned int node(Op op, unsigned int a, unsigned int b = 0);
+  unsigned int constant(Real value);
+  unsigned int power(unsigned int base, unsigned int exponent);
+  bool isConstant(unsigned int n) const { return _node_op[n] == Op::Constant; }
+  static bool isUnary(Op op);
+
+  /// Matches node n = exp(lnA + n*ln(T) - E/T)
+  bool matchExponential(unsigned int n, Arrhenius & form) const;
+  /// Matches node n = lnA + n*ln(T) - E/T
+  bool matchLinear(unsigned int n, Arrhenius & form) const;
+  /// form += scale * other, if both refer to the same variable
+  static bool combine(Arrhenius & form, const Arrhenius & other, Real scale);
+
+  /// Recursive descent parser over _text, starting at _pos
+  unsigned int parseSum();
+  unsigned int parseProduct();
+  unsigned int parseUnary();
+  unsigned int parsePower();
+  unsigned int parsePrimary();
+  unsigned int parseFunction(const std::string & name);
+  void skipWhitespace();
+  bool accept(char c);
+  void expect(char c);
+  unsigned int parse(const std::string & expression);
+
+  std::vector<std::string> _variable_names;
+  std::map<std::string, unsigned int> _constants;
+
+  /// Graph nodes. Node values are stored in _values; constants are set once at parse time.
+  std::vector<Op> _node_op;
+  std::vector<unsigned int> _node_a;
+  std::vector<unsigned int> _node_b;
+  std::vector<Real> _values;
+  /// d(node)/d(variable), stored node by node
+  std::vector<Real> _derivatives;
+  std::map<std::tuple<Op, unsigned int, unsigned int>, unsigned int> _node_map;
+  std::map<Real, unsigned int> _constant_map;
+
+  /// Variable nodes (in constructor order), non-constant operations and output nodes
+  std::vector<unsigned int> _variable_nodes;
+  std::vector<Instruction> _tape;
+  std::vector<unsigned int> _outputs;
+
+  /// Arrhenius expressions, sorted by variable (structure of arrays)
+  std::vector<Real> _arr_lnA;
+  std::vector<Real> _arr_n;
+  std::vector<Real> _arr_E;
+  std::vector<Real> _arr_k;
+  std::vector<Real> _arr_dk;
+  std::vector<unsigned int> _arr_root;
+  /// Range of Arrhenius entries belonging to each variable
+  std::vector<unsigned int> _arr_offset;
+  /// Arrhenius entry of each output (-1 for tape expressions)
+  std::vector<int> _output_arrhenius;
+  bool _finalized;
+
+  std::string _text;
+  std::size_t _pos;
+  std::string _error;
+};
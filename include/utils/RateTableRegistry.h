@@ -0,0 +1,72 @@
+//* This file is part of Crane, an open-source
+//* application for plasma chemistry and thermochemistry
+//* https://github.com/lcpp-org/crane
+//*
+//* Crane is powered by the MOOSE Framework
+//* https://www.mooseframework.org
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseTypes.h"
+#include "LinearInterpolation.h"
+#include "SplineInterpolation.h"
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/**
+ * Process-wide cache of two-column data tables (x y pairs, whitespace separated), such as rate
+ * coefficient, transport and mobility tables.
+ *
+ * Each file is read once. Tables are deduplicated by content hash, so identical files at different
+ * paths share storage, and a file whose size or modification time changes is read again.
+ * Interpolators built from a table are cached too. Everything handed out is immutable and safe to
+ * share between objects, blocks and threads.
+ */
+class RateTableRegistry
+{
+public:
+  struct Table
+  {
+    std::vector<Real> x;
+    std::vector<Real> y;
+  };
+
+  /// The table stored in file_name, optionally sorted by x
+  static std::shared_ptr<const Table> table(const std::string & file_name, bool sort = false);
+
+  /// A cubic spline through the table stored in file_name
+  static std::shared_ptr<const SplineInterpolation> spline(const std::string & file_name,
+                                                           bool sort = false);
+
+  /// A piecewise linear interpolation of the table stored in file_name
+  static std::shared_ptr<const LinearInterpolation> linear(const std::string & file_name,
+                                                           bool extrapolate = false);
+
+protected:
+  struct FileEntry
+  {
+    long long mtime;
+    long long size;
+    std::string hash;
+  };
+
+  /// Returns the content hash of file_name, loading and parsing it if necessary
+  static std::string load(const std::string & file_name);
+  /// Returns the (optionally sorted) table of file_name and its key in _tables. Requires _mutex.
+  static std::shared_ptr<const Table>
+  find(const std::string & file_name, bool sort, std::string & key);
+
+  static std::mutex _mutex;
+  static std::map<std::string, FileEntry> _files;
+  /// Tables (and interpolators) keyed by content hash, plus " sorted" for sorted tables
+  static std::map<std::string, std::shared_ptr<const Table>> _tables;
+  static std::map<std::string, std::shared_ptr<const SplineInterpolation>> _splines;
+  static std::map<std::string, std::shared_ptr<const LinearInterpolation>> _linears;
+};
@@ -0,0 +1,77 @@
+//* This file is part of Crane, an open-source
+//* application for plasma chemistry and thermochemistry
+//* https://github.com/lcpp-org/crane
+//*
+//* Crane is powered by the MOOSE Framework
+//* https://www.mooseframework.org
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseTypes.h"
+#include "libmesh/parallel.h"
+
+#include <string>
+#include <vector>
+
+/**
+ * Generates specialized C++ for the residual and Jacobian of a reaction network, compiles it into
+ * a shared library and loads it with dlopen. Libraries are cached on disk under a hash of the
+ * generated source, the compiler and its version, so repeated runs with the same network skip
+ * compilation. Only the rate products and the stoichiometric scatter are generated; rate
+ * coefficient expressions are left to FParser's own JIT.
+ *
+ * Processor 0 compiles and every processor loads the library from the cache directory, which must
+ * therefore be on a file system shared by all nodes of a parallel run.
+ *
+ * The generated functions have the signature f(k, n, out), where k holds the rate coefficients,
+ * n the species densities (tracked species followed by untracked reactants) and out receives the
+ * species residuals or the Jacobian values in sparsity pattern order.
+ */
+class ReactionNetworkCompiler
+{
+public:
+  typedef void (*NetworkFunction)(const double *, const double *, double *);
+
+  ReactionNetworkCompiler(const std::string & cache_directory, const std::string & compiler);
+  ~ReactionNetworkCompiler();
+
+  /// Builds the source code for the network described by the CSR arrays of ReactionNetworkScalar
+  static std::string generateSource(bool use_log,
+                                    unsigned int num_species,
+                                    const std::vector<unsigned int> & reactant_offset,
+                                    const std::vector<unsigned int> & reactant,
+                                    const std::vector<unsigned int> & stoich_offset,
+                                    const std::vector<unsigned int> & stoich_species,
+                                    const std::vector<Real> & stoich_coeff,
+                                    const std::vector<unsigned int> & jacobian_slot,
+                                    unsigned int num_jacobian_entries);
+
+  /**
+   * Compiles (on processor 0, unless a cached library exists) and loads the library for the given
+   * source. Returns false with a message in error(), including the compiler output, if
+   * compilation or loading failed.
+   */
+  bool load(const std::string & source, const Parallel::Communicator & comm);
+
+  NetworkFunction residual() const { return _residual; }
+  NetworkFunction jacobian() const { return _jacobian; }
+  const std::string & error() const { return _error; }
+  /// Path of the loaded library
+  const std::string & library() const { return _library; }
+  /// Whether the library was found in the cache rather than compiled by this run
+  bool cached() const { return _cached; }
+
+protected:
+  const std::string _cache_directory;
+  const std::string _compiler;
+
+  void * _handle;
+  NetworkFunction _residual;
+  NetworkFunction _jacobian;
+  std::string _error;
+  std::string _library;
+  bool _cached;
+};
@@ -0,0 +1,126 @@
+//* This file is part of Crane, an open-source
+//* application for plasma chemistry and thermochemistry
+//* https://github.com/lcpp-org/crane
+//*
+//* Crane is powered by the MOOSE Framework
+//* https://www.mooseframework.org
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseTypes.h"
+
+#include <functional>
+#include <vector>
+
+/**
+ * Adaptive integrator for stiff autonomous ODE systems dy/dt = f(y), using the two-stage,
+ * second-order, L-stable Rosenbrock method ROS2 of Verwer et al., SIAM J. Sci. Comput. 20 (1999)
+ * 1456, with its embedded first-order solution for step size control.
+ *
+ * Each step evaluates f twice and the Jacobian once, and factors I - gamma h J once with dense LU.
+ * No Newton iterations are needed, so a step cannot fail to converge; it is only rejected if the
+ * error estimate exceeds the tolerance.
+ *
+ * An ensemble of independent copies of the same system (e.g. one network under different initial
+ * conditions or parameters) can be integrated together. Each member keeps its own step size, but
+ * the members advance in lockstep rounds so that every evaluation of f covers all of them at once.
+ */
+class RosenbrockIntegrator
+{
+public:
+  /**
+   * Evaluates f(y) and, if the pointer is not null, the dense Jacobian df/dy (row-major, resized by
+   * the caller to n * n)
+   */
+  typedef std::function<void(const std::vector<Real> & y, std::vector<Real> & f, Real * jacobian)>
+      System;
+
+  /**
+   * Evaluates f and, if the pointer is not null, the Jacobian for the listed ensemble members.
+   * Values are stored member-fastest: y[i * size + b] is component i of members[b], and the
+   * Jacobian entry (r, c) of that member is jacobian[(r * n + c) * size + b], zeroed by the
+   * caller.
+   */
+  typedef std::function<void(const std::vector<unsigned int> & members,
+                             const std::vector<Real> & y,
+                             std::vector<Real> & f,
+                             Real * jacobian)>
+      EnsembleSystem;
+
+  RosenbrockIntegrator(Real relative_tolerance, Real absolute_tolerance, unsigned int max_steps);
+
+  /**
+   * Integrates y over an interval of length dt. `h` is the first step size to try (0 chooses one)
+   * and returns the last accepted step size, to start the next interval with. Returns false if
+   * max_steps steps were not enough or a step size underflowed.
+   */
+  bool integrate(const System & system, std::vector<Real> & y, Real dt, Real & h);
+
+  /**
+   * Integrates every member of an ensemble over an interval of length dt. y holds the members one
+   * after the other and h the step size of each member, as in integrate(). Returns false if a
+   * member needed more than max_steps steps or its step size underflowed.
+   */
+  bool integrateEnsemble(const EnsembleSystem & system,
+                         unsigned int members,
+                         std::vector<Real> & y,
+                         Real dt,
+                         std::vector<Real> & h);
+
+  /// Accepted and rejected steps of the last integrate() call (summed over the ensemble members)
+  unsigned int acceptedSteps() const { return _accepted; }
+  unsigned int rejectedSteps() const { return _rejected; }
+
+  /// LU factorization with partial pivoting of the n x n row-major matrix a, in place
+  static bool factor(Real * a, unsigned int * pivot, unsigned int n);
+  /// Solves with the factorization of factor(), overwriting b with the solution
+  static void solve(const Real * a, const unsigned int * pivot, unsigned int n, Real * b);
+
+protected:
+  /// Copies the states of the listed members into _batch_y, member-fastest
+  void gather(const std::vector<unsigned int> & batch, const std::vector<Real> & y, unsigned int n);
+  /// A first step size that changes y by about the tolerance
+  Real initialStep(const Real * y, const Real * f, unsigned int n, Real dt) const;
+  /// The step to take from t, given the proposed size h
+  static Real limitStep(Real h, Real t, Real dt);
+  /// Forms and factors I - gamma h J
+  static bool factorStage(
+      const Real * jacobian, Real step, unsigned int n, Real * matrix, unsigned int * pivot);
+  /// Writes the second order solution to y_new and returns the weighted RMS error estimate
+  Real combineStages(const Real * y,
+                     const Real * k1,
+                     const Real * k2,
+                     Real step,
+                     unsigned int n,
+                     Real * y_new) const;
+  /// Advances t if the error is within tolerance, and sets the next step size h
+  static bool acceptStep(Real error, Real step, Real & t, Real dt, Real & h);
+
+  const Real _rtol;
+  const Real _atol;
+  const unsigned int _max_steps;
+  unsigned int _accepted;
+  unsigned int _rejected;
+
+  /// Work arrays (stored member by member for an ensemble)
+  std::vector<Real> _jacobian;
+  std::vector<Real> _matrix;
+  std::vector<unsigned int> _pivot;
+  std::vector<Real> _f;
+  std::vector<Real> _k1;
+  std::vector<Real> _k2;
+  std::vector<Real> _stage;
+
+  /// Time, step count, current step and whether the Jacobian is up to date, per member
+  std::vector<Real> _member_time;
+  std::vector<unsigned int> _member_steps;
+  std::vector<Real> _member_step;
+  std::vector<bool> _member_jacobian;
+  /// Arguments of the batched evaluations, member-fastest
+  std::vector<Real> _batch_y;
+  std::vector<Real> _batch_f;
+  std::vector<Real> _batch_jacobian;
+};
@@ -0,0 +1,52 @@
+//* This file is part of Crane, an open-source
+//* application for plasma chemistry and thermochemistry
+//* https://github.com/lcpp-org/crane
+//*
+//* Crane is powered by the MOOSE Framework
+//* https://www.mooseframework.org
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseTypes.h"
+#include "InputParameters.h"
+
+#include <vector>
+
+class MooseObject;
+
+/**
+ * Rates r_i = k_i prod_m N_m of the reactions of a scalar network, evaluated from the coupled rate
+ * coefficients and densities of a running simulation. Shared by the objects that analyze a
+ * network (ScalarReactionRates, RateOfProductionAnalysis and MechanismReduction), which add
+ * validParams() to their own parameters.
+ */
+class ScalarNetworkRates
+{
+public:
+  /// The species, args, rate_coefficients, reactants and use_log parameters
+  static InputParameters validParams();
+
+  /**
+   * Reads 'reactants' and 'use_log' from the parameters of object. The densities are the
+   * species followed by the args, and there is one rate coefficient per reaction.
+   */
+  ScalarNetworkRates(const MooseObject & object,
+                     const std::vector<const VariableValue *> & density,
+                     const std::vector<const VariableValue *> & rate_coefficient);
+
+  unsigned int numReactions() const { return _rate_coefficient.size(); }
+
+  /// Writes the current rate of every reaction
+  void compute(std::vector<Real> & rate) const;
+
+protected:
+  const bool _use_log;
+  const std::vector<const VariableValue *> _density;
+  const std::vector<const VariableValue *> _rate_coefficient;
+  /// Reactants of each reaction as indices into _density (CSR layout)
+  std::vector<unsigned int> _reactant_offset;
+  std::vector<unsigned int> _reactant;
+};
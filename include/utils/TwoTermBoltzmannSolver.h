@@ -0,0 +1,143 @@
+//* This file is part of Crane, an open-source
+//* application for plasma chemistry and thermochemistry
+//* https://github.com/lcpp-org/crane
+//*
+//* Crane is powered by the MOOSE Framework
+//* https://www.mooseframework.org
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseTypes.h"
+
+#include <string>
+#include <vector>
+
+/**
+ * Steady-state, spatially homogeneous two-term Boltzmann solver for the electron energy
+ * distribution function (EEDF) in a gas mixture, following Hagelaar and Pitchford, Plasma Sources
+ * Sci. Technol. 14 (2005) 722 (the same formulation as BOLSIG+ and BOLOS).
+ *
+ * Cross sections are read from an LXCat-format file (ELASTIC, EFFECTIVE, EXCITATION, IONIZATION
+ * and ATTACHMENT blocks). The isotropic part F0 is discretized on a uniform energy grid with
+ * Scharfetter-Gummel fluxes and energy-conserving inelastic source terms, which gives a matrix with
+ * one subdiagonal that is solved directly. The grid extent adapts to the tail of the distribution.
+ *
+ * Ionization is treated as an excitation at the threshold energy (no secondary electrons and no
+ * growth term), and electron-electron collisions are neglected.
+ */
+class TwoTermBoltzmannSolver
+{
+public:
+  enum class Process
+  {
+    Elastic,
+    Effective,
+    Excitation,
+    Ionization,
+    Attachment
+  };
+
+  struct CrossSection
+  {
+    Process kind;
+    /// Index of the target species
+    unsigned int species;
+    /// Target line of the LXCat block, e.g. "N2 -> N2(A3)"
+    std::string target;
+    /// Mass ratio m_e/M (elastic, effective) or threshold energy in eV (excitation, ionization)
+    Real parameter;
+    std::vector<Real> energy;
+    std::vector<Real> sigma;
+  };
+
+  /// Reads the processes of the given species (other species in the file are skipped)
+  TwoTermBoltzmannSolver(const std::string & file_name, const std::vector<std::string> & species);
+
+  /**
+   * The process of `species` whose kind matches `kind` (case insensitive, e.g. "Ionization") and,
+   * if `threshold` is positive, whose threshold is within 1% of it. Returns -1 if there is no
+   * unique match.
+   */
+  int findProcess(const std::string & species, const std::string & kind, Real threshold) const;
+
+  /// Number of energy cells and the initial grid extent in eV
+  void setGrid(unsigned int cells, Real max_energy);
+  void setGasTemperature(Real temperature) { _kT = _kB_over_e * temperature; }
+
+  /**
+   * Solves for F0 at the given reduced field (Td) and mole fractions (ordered as the species).
+   * Throws std::invalid_argument if the number of mole fractions is wrong.
+   */
+  void solve(Real reduced_field, const std::vector<Real> & mole_fractions);
+
+  /// Rate coefficient of process p in m^3/s
+  Real rateCoefficient(unsigned int p) const;
+  /// Mean electron energy in eV
+  Real meanEnergy() const;
+  /// Reduced mobility mu*N in 1/(m V s)
+  Real reducedMobility() const;
+
+  const std::vector<CrossSection> & processes() const { return _processes; }
+  /// Energies of the cell centers (eV) and F0 there (eV^-3/2)
+  const std::vector<Real> & energy() const { return _center; }
+  const std::vector<Real> & distribution() const { return _f0; }
+
+protected:
+  void readCrossSections(const std::string & file_name, const std::vector<std::string> & species);
+  /// Interpolates a cross section. Beyond the last point it is constant; below the first point it
+  /// is zero for inelastic processes and constant for momentum transfer.
+  static Real sigma(const CrossSection & xs, Real energy);
+  /// Integral of energy * sigma(energy) from a to b, exact for piecewise linear cross sections
+  static Real energyIntegral(const CrossSection & xs, Real a, Real b);
+  /// Computes the grid and the cross section integrals that only depend on the grid
+  void buildGrid(Real max_energy);
+  /// Assembles and solves the discrete equations on the current grid
+  void solveOnGrid(Real reduced_field, const std::vector<Real> & mole_fractions);
+  /// Energy at which F0 has fallen to the tail tolerance (extrapolated beyond the grid)
+  Real tailEnergy() const;
+
+  static constexpr Real _gamma = 5.930969e5;
+  static constexpr Real _kB_over_e = 8.617333262e-5;
+
+  std::vector<std::string> _species;
+  std::vector<CrossSection> _processes;
+  /// Whether each species has an EFFECTIVE (rather than ELASTIC) momentum transfer cross section
+  std::vector<bool> _effective;
+  /// Electron to molecule mass ratio of each species
+  std::vector<Real> _mass_ratio;
+
+  unsigned int _cells;
+  Real _max_energy;
+  Real _kT;
+
+  /// Cell boundaries and centers
+  std::vector<Real> _boundary;
+  std::vector<Real> _center;
+  /// Per species at interior boundaries: elastic energy loss (2 m/M) sigma_el and total momentum
+  /// transfer cross sections, stored boundary by boundary
+  std::vector<Real> _sigma_energy;
+  std::vector<Real> _sigma_momentum;
+  /// Integral of energy * sigma over each cell, for every process
+  std::vector<std::vector<Real>> _cell_integral;
+  /// Inelastic gains: (process, destination cell, source cell, integral over the shifted overlap)
+  struct Gain
+  {
+    unsigned int process;
+    unsigned int to;
+    unsigned int from;
+    Real integral;
+  };
+  std::vector<Gain> _gains;
+  /// Largest source - destination cell distance (upper bandwidth of the matrix)
+  unsigned int _upper;
+
+  /// Banded matrix, one subdiagonal and _upper superdiagonals, stored row by row
+  std::vector<Real> _matrix;
+  std::vector<Real> _rhs;
+  std::vector<Real> _f0;
+  /// Mixture momentum transfer cross section at the interior boundaries
+  std::vector<Real> _sigma_mixture;
+};
@@ -0,0 +1,58 @@
+//* This file is part of Crane, an open-source
+//* application for plasma chemistry and thermochemistry
+//* https://github.com/lcpp-org/crane
+//*
+//* Crane is powered by the MOOSE Framework
+//* https://www.mooseframework.org
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "GeneralVectorPostprocessor.h"
+#include "ScalarNetworkRates.h"
+
+/**
+ * Rate-of-production analysis of a scalar network: for each target species, the reactions that
+ * contribute most to its production and to its destruction.
+ *
+ * Each reaction i contributes nu_iA * r_i to species A. The `top` largest producers and destroyers
+ * of each target are reported with their share of the total production (or destruction) and their
+ * normalized sensitivity nu_iA * r_i / w_A = d ln(w_A) / d ln(k_i), where w_A is the net rate.
+ * Rows come in blocks of 2 * top per target: the producers, largest first, then the destroyers.
+ * Unused rows have reaction = -1.
+ */
+class RateOfProductionAnalysis : public GeneralVectorPostprocessor
+{
+public:
+  RateOfProductionAnalysis(const InputParameters & parameters);
+
+  static InputParameters validParams();
+
+  virtual void initialize() override {}
+  virtual void execute() override;
+  virtual void finalize() override {}
+
+protected:
+  const unsigned int _interval;
+  const unsigned int _num_reactions;
+  const unsigned int _top;
+
+  std::unique_ptr<ScalarNetworkRates> _rates;
+  /// Reaction number and net coefficient of every reaction changing each target (CSR layout)
+  std::vector<unsigned int> _target_offset;
+  std::vector<unsigned int> _target_reaction;
+  std::vector<Real> _target_coeff;
+  std::vector<Real> _reaction_numbers;
+
+  VectorPostprocessorValue & _target;
+  VectorPostprocessorValue & _reaction;
+  VectorPostprocessorValue & _contribution;
+  VectorPostprocessorValue & _fraction;
+  VectorPostprocessorValue & _sensitivity;
+
+  /// Work arrays
+  std::vector<Real> _rate;
+  std::vector<std::pair<Real, unsigned int>> _ranked;
+};
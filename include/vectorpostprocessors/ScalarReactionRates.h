@@ -0,0 +1,42 @@
+//* This file is part of Crane, an open-source
+//* application for plasma chemistry and thermochemistry
+//* https://github.com/lcpp-org/crane
+//*
+//* Crane is powered by the MOOSE Framework
+//* https://www.mooseframework.org
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "GeneralVectorPostprocessor.h"
+#include "ScalarNetworkRates.h"
+
+/**
+ * Computes the rate k_i * prod(N_m) of every reaction of a scalar network in a single loop, and
+ * stores the rates in one contiguous vector (with the matching reaction numbers in another).
+ *
+ * This replaces one aux variable and one ReactionRate*BodyScalar aux kernel per reaction. Rates
+ * are only computed on timesteps that are a multiple of `interval`, which should match the
+ * interval of the output writing them.
+ */
+class ScalarReactionRates : public GeneralVectorPostprocessor
+{
+public:
+  ScalarReactionRates(const InputParameters & parameters);
+
+  static InputParameters validParams();
+
+  virtual void initialize() override {}
+  virtual void execute() override;
+  virtual void finalize() override {}
+
+protected:
+  const unsigned int _interval;
+  const unsigned int _num_reactions;
+  std::unique_ptr<ScalarNetworkRates> _rates;
+
+  VectorPostprocessorValue & _reaction;
+  VectorPostprocessorValue & _rate;
+};
@@ -0,0 +1,157 @@
+# BoltzmannSolverScalar (solver = native) with a reduced field ramping from 50 Td by 25 Td per
+# step. The field is updated on TIMESTEP_END, so the solve on TIMESTEP_BEGIN of step n uses the
+# field of step n - 1.
+#
+# With asynchronous = true, the results of a background solve are taken exactly max_lag steps
+# after it started. With max_lag = 1 the output is therefore the synchronous output delayed by
+# one step, on any number of processes and regardless of how long the solves take.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  xmin = 0
+  xmax = 1
+  nx = 1
+[]
+
+[Problem]
+  solve = false
+  kernel_coverage_check = false
+[]
+
+[AuxVariables]
+  [reduced_field]
+    family = SCALAR
+    order = FIRST
+  []
+
+  [x_A]
+    family = SCALAR
+    order = FIRST
+    initial_condition = 1
+  []
+
+  [neutral_density]
+    family = SCALAR
+    order = FIRST
+    initial_condition = 1e24
+  []
+
+  [ionization_fraction]
+    family = SCALAR
+    order = FIRST
+    initial_condition = 0
+  []
+
+  [mean_energy]
+    family = SCALAR
+    order = FIRST
+  []
+
+  [mobility]
+    family = SCALAR
+    order = FIRST
+  []
+
+  [k_excitation]
+    family = SCALAR
+    order = FIRST
+  []
+[]
+
+[Functions]
+  [ramp]
+    type = ParsedFunction
+    value = '(50 + 25 * t) * 1e-21'
+  []
+[]
+
+[ICs]
+  [reduced_field]
+    type = FunctionScalarIC
+    variable = reduced_field
+    function = ramp
+  []
+[]
+
+[UserObjects]
+  [boltzmann]
+    type = BoltzmannSolverScalar
+    solver = native
+    cross_section_data = 'constant_xs'
+    species = 'A'
+    mole_fractions = 'x_A'
+    reduced_field = reduced_field
+    neutral_density = neutral_density
+    ionization_fraction = ionization_fraction
+    reaction_species = 'A'
+    reaction_type = 'Excitation'
+    reaction_number = '0'
+    number_reactions = 1
+    gas_temperature = 300
+    execute_on = 'INITIAL TIMESTEP_BEGIN'
+  []
+[]
+
+[AuxScalarKernels]
+  [reduced_field]
+    type = FunctionScalarAux
+    variable = reduced_field
+    function = ramp
+    execute_on = 'TIMESTEP_END'
+  []
+
+  [mean_energy]
+    type = BolsigValueScalar
+    variable = mean_energy
+    data_provider = boltzmann
+    data_type = electron_temperature
+    execute_on = 'INITIAL TIMESTEP_END'
+  []
+
+  [mobility]
+    type = BolsigValueScalar
+    variable = mobility
+    data_provider = boltzmann
+    data_type = mobility
+    execute_on = 'INITIAL TIMESTEP_END'
+  []
+
+  [k_excitation]
+    type = EEDFRateCoefficientScalar
+    variable = k_excitation
+    rate_provider = boltzmann
+    reaction_number = 0
+    execute_on = 'INITIAL TIMESTEP_END'
+  []
+[]
+
+[Postprocessors]
+  [mean_energy]
+    type = ScalarVariable
+    variable = mean_energy
+    execute_on = 'INITIAL TIMESTEP_END'
+  []
+
+  [mobility]
+    type = ScalarVariable
+    variable = mobility
+    execute_on = 'INITIAL TIMESTEP_END'
+  []
+
+  [k_excitation]
+    type = ScalarVariable
+    variable = k_excitation
+    execute_on = 'INITIAL TIMESTEP_END'
+  []
+[]
+
+[Executioner]
+  type = Transient
+  dt = 1
+  num_steps = 5
+[]
+
+[Outputs]
+  csv = true
+[]
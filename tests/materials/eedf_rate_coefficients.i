@@ -0,0 +1,391 @@
+# EEDFRateCoefficients against the per-reaction materials on the same tables: splines against
+# ZapdosEEDFRateConstant (rate coefficients and their energy derivatives) and linear
+# interpolation against InterpolatedCoefficientLinear (an AD material). The mean energy ranges
+# from 0.2 to 30.2 eV, beyond both ends of the tables, so the extrapolation is compared too.
+# attachment.txt has its own energy grid, so EEDFRateCoefficients samples two grids.
+#
+# spline_difference and linear_difference are the largest (over the elements) sums of the
+# differences, each scaled by the size of its table's values, and must vanish. k_ionization is the
+# average spline ionization rate coefficient, which shows the materials were evaluated.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  xmin = 0
+  xmax = 1
+  nx = 20
+[]
+
+[Problem]
+  solve = false
+  kernel_coverage_check = false
+[]
+
+[Functions]
+  [log_energy]
+    type = ParsedFunction
+    value = 'log(0.2 + 30 * x)'
+  []
+[]
+
+[AuxVariables]
+  [em]
+    initial_condition = 0
+  []
+
+  [mean_en]
+  []
+
+  [ks_ion]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+
+  [kz_ion]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+
+  [dks_ion]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+
+  [dkz_ion]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+
+  [ks_exc]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+
+  [kz_exc]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+
+  [dks_exc]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+
+  [dkz_exc]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+
+  [ks_att]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+
+  [kz_att]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+
+  [dks_att]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+
+  [dkz_att]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+
+  [kl_ion]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+
+  [ka_ion]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+
+  [kl_exc]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+
+  [ka_exc]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+
+  [kl_att]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+
+  [ka_att]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+
+  [spline_difference]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+
+  [linear_difference]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+[]
+
+[ICs]
+  [mean_en]
+    type = FunctionIC
+    variable = mean_en
+    function = log_energy
+  []
+[]
+
+[Materials]
+  [spline]
+    type = EEDFRateCoefficients
+    property_files = 'ionization.txt excitation.txt attachment.txt'
+    reactions = 'ion exc att'
+    numbers = 's s s'
+    file_location = 'rate_tables'
+    mean_energy = mean_en
+    electrons = em
+  []
+
+  [linear]
+    type = EEDFRateCoefficients
+    interpolation_type = linear
+    property_files = 'ionization.txt excitation.txt attachment.txt'
+    reactions = 'ion exc att'
+    numbers = 'l l l'
+    file_location = 'rate_tables'
+    mean_energy = mean_en
+    electrons = em
+  []
+
+  [zapdos_ion]
+    type = ZapdosEEDFRateConstant
+    property_file = 'ionization.txt'
+    reaction = ion
+    number = z
+    file_location = 'rate_tables'
+    mean_energy = mean_en
+    electrons = em
+  []
+
+  [zapdos_exc]
+    type = ZapdosEEDFRateConstant
+    property_file = 'excitation.txt'
+    reaction = exc
+    number = z
+    file_location = 'rate_tables'
+    mean_energy = mean_en
+    electrons = em
+  []
+
+  [zapdos_att]
+    type = ZapdosEEDFRateConstant
+    property_file = 'attachment.txt'
+    reaction = att
+    number = z
+    file_location = 'rate_tables'
+    mean_energy = mean_en
+    electrons = em
+  []
+
+  [interpolated_ion]
+    type = InterpolatedCoefficientLinear
+    property_file = 'ionization.txt'
+    reaction = ion
+    number = a
+    file_location = 'rate_tables'
+    mean_energy = mean_en
+    electrons = em
+  []
+
+  [interpolated_exc]
+    type = InterpolatedCoefficientLinear
+    property_file = 'excitation.txt'
+    reaction = exc
+    number = a
+    file_location = 'rate_tables'
+    mean_energy = mean_en
+    electrons = em
+  []
+
+  [interpolated_att]
+    type = InterpolatedCoefficientLinear
+    property_file = 'attachment.txt'
+    reaction = att
+    number = a
+    file_location = 'rate_tables'
+    mean_energy = mean_en
+    electrons = em
+  []
+[]
+
+[AuxKernels]
+  [ks_ion]
+    type = MaterialRealAux
+    variable = ks_ion
+    property = ks_ion
+  []
+
+  [kz_ion]
+    type = MaterialRealAux
+    variable = kz_ion
+    property = kz_ion
+  []
+
+  [dks_ion]
+    type = MaterialRealAux
+    variable = dks_ion
+    property = d_ks_d_en_ion
+  []
+
+  [dkz_ion]
+    type = MaterialRealAux
+    variable = dkz_ion
+    property = d_kz_d_en_ion
+  []
+
+  [kl_ion]
+    type = MaterialRealAux
+    variable = kl_ion
+    property = kl_ion
+  []
+
+  [ka_ion]
+    type = ADMaterialRealAux
+    variable = ka_ion
+    property = ka_ion
+  []
+
+  [ks_exc]
+    type = MaterialRealAux
+    variable = ks_exc
+    property = ks_exc
+  []
+
+  [kz_exc]
+    type = MaterialRealAux
+    variable = kz_exc
+    property = kz_exc
+  []
+
+  [dks_exc]
+    type = MaterialRealAux
+    variable = dks_exc
+    property = d_ks_d_en_exc
+  []
+
+  [dkz_exc]
+    type = MaterialRealAux
+    variable = dkz_exc
+    property = d_kz_d_en_exc
+  []
+
+  [kl_exc]
+    type = MaterialRealAux
+    variable = kl_exc
+    property = kl_exc
+  []
+
+  [ka_exc]
+    type = ADMaterialRealAux
+    variable = ka_exc
+    property = ka_exc
+  []
+
+  [ks_att]
+    type = MaterialRealAux
+    variable = ks_att
+    property = ks_att
+  []
+
+  [kz_att]
+    type = MaterialRealAux
+    variable = kz_att
+    property = kz_att
+  []
+
+  [dks_att]
+    type = MaterialRealAux
+    variable = dks_att
+    property = d_ks_d_en_att
+  []
+
+  [dkz_att]
+    type = MaterialRealAux
+    variable = dkz_att
+    property = d_kz_d_en_att
+  []
+
+  [kl_att]
+    type = MaterialRealAux
+    variable = kl_att
+    property = kl_att
+  []
+
+  [ka_att]
+    type = ADMaterialRealAux
+    variable = ka_att
+    property = ka_att
+  []
+
+  [spline_difference]
+    type = ParsedAux
+    variable = spline_difference
+    args = 'ks_ion kz_ion dks_ion dkz_ion ks_exc kz_exc dks_exc dkz_exc
+            ks_att kz_att dks_att dkz_att'
+    function = 'abs(ks_ion - kz_ion) / 2.03e-14 + abs(dks_ion - dkz_ion) / 1.4e-15
+                + abs(ks_exc - kz_exc) / 2.8e-15 + abs(dks_exc - dkz_exc) / 2.3e-16
+                + abs(ks_att - kz_att) / 1e-16 + abs(dks_att - dkz_att) / 3e-17'
+  []
+
+  [linear_difference]
+    type = ParsedAux
+    variable = linear_difference
+    args = 'kl_ion ka_ion kl_exc ka_exc kl_att ka_att'
+    function = 'abs(kl_ion - ka_ion) / 2.03e-14 + abs(kl_exc - ka_exc) / 2.8e-15
+                + abs(kl_att - ka_att) / 1e-16'
+  []
+[]
+
+[Postprocessors]
+  [spline_difference]
+    type = ElementExtremeValue
+    variable = spline_difference
+  []
+
+  [linear_difference]
+    type = ElementExtremeValue
+    variable = linear_difference
+  []
+
+  [k_ionization]
+    type = ElementAverageValue
+    variable = ks_ion
+  []
+[]
+
+[Executioner]
+  type = Transient
+  dt = 1
+  num_steps = 1
+
+  # One quadrature point per element, at its centre, so that k_ionization is known exactly
+  [Quadrature]
+    type = GAUSS
+    order = FIRST
+  []
+[]
+
+[Outputs]
+  csv = true
+  execute_on = 'TIMESTEP_END'
+[]
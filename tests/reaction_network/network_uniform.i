@@ -0,0 +1,93 @@
+# Three species reacting in a 1-D domain with uniform initial values. The densities stay
+# uniform, so the finite element solution equals the solution of the 0-D network
+#   dA/dt = -k1 A + k3 C,  dB/dt = k1 A - 2 k2 B^2,  dC/dt = k2 B^2 - k3 C
+# and the gold values are its backward Euler solution.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  xmin = 0
+  xmax = 1
+  nx = 4
+[]
+
+[Variables]
+  [A]
+    initial_condition = 1
+  []
+
+  [B]
+    initial_condition = 0.5
+  []
+
+  [C]
+    initial_condition = 0
+  []
+[]
+
+[Kernels]
+  [dA_dt]
+    type = TimeDerivative
+    variable = A
+  []
+
+  [dB_dt]
+    type = TimeDerivative
+    variable = B
+  []
+
+  [dC_dt]
+    type = TimeDerivative
+    variable = C
+  []
+[]
+
+[ChemicalReactions]
+  [Network]
+    species = 'A B C'
+    block = 0
+    reactions = 'A -> B          : 1.0
+                 B + B -> C      : 0.5
+                 C -> A          : 0.2'
+  []
+[]
+
+[Postprocessors]
+  [avg_A]
+    type = ElementAverageValue
+    variable = A
+    execute_on = 'INITIAL TIMESTEP_END'
+  []
+
+  [avg_B]
+    type = ElementAverageValue
+    variable = B
+    execute_on = 'INITIAL TIMESTEP_END'
+  []
+
+  [avg_C]
+    type = ElementAverageValue
+    variable = C
+    execute_on = 'INITIAL TIMESTEP_END'
+  []
+[]
+
+[Executioner]
+  type = Transient
+  dt = 0.1
+  num_steps = 6
+  solve_type = 'newton'
+  nl_rel_tol = 1e-12
+  nl_abs_tol = 1e-14
+[]
+
+[Preconditioning]
+  [smp]
+    type = SMP
+    full = true
+  []
+[]
+
+[Outputs]
+  csv = true
+[]
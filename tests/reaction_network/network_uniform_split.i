@@ -0,0 +1,100 @@
+# network_uniform.i with the chemistry integrated node by node (operator_split = lie). The
+# densities stay uniform, so the split integration must reproduce the exact solution of the 0-D
+# network
+#   dA/dt = -k1 A + k3 C,  dB/dt = k1 A - 2 k2 B^2,  dC/dt = k2 B^2 - k3 C
+# and the gold values are computed from it directly.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  xmin = 0
+  xmax = 1
+  nx = 4
+[]
+
+[Variables]
+  [A]
+    initial_condition = 1
+  []
+
+  [B]
+    initial_condition = 0.5
+  []
+
+  [C]
+    initial_condition = 0
+  []
+[]
+
+[Kernels]
+  [dA_dt]
+    type = TimeDerivative
+    variable = A
+  []
+
+  [dB_dt]
+    type = TimeDerivative
+    variable = B
+  []
+
+  [dC_dt]
+    type = TimeDerivative
+    variable = C
+  []
+[]
+
+[ChemicalReactions]
+  [Network]
+    species = 'A B C'
+    block = 0
+    reactions = 'A -> B          : 1.0
+                 B + B -> C      : 0.5
+                 C -> A          : 0.2'
+    operator_split = lie
+    split_relative_tolerance = 1e-8
+    split_absolute_tolerance = 1e-10
+  []
+[]
+
+# With operator splitting the chemistry is integrated after the element user objects (including
+# these postprocessors) have executed on TIMESTEP_END, so the averages are taken at the start of
+# each step: the value at time t_n is the density at t_(n-1).
+[Postprocessors]
+  [avg_A]
+    type = ElementAverageValue
+    variable = A
+    execute_on = 'INITIAL TIMESTEP_BEGIN'
+  []
+
+  [avg_B]
+    type = ElementAverageValue
+    variable = B
+    execute_on = 'INITIAL TIMESTEP_BEGIN'
+  []
+
+  [avg_C]
+    type = ElementAverageValue
+    variable = C
+    execute_on = 'INITIAL TIMESTEP_BEGIN'
+  []
+[]
+
+[Executioner]
+  type = Transient
+  dt = 0.1
+  num_steps = 6
+  solve_type = 'newton'
+  nl_rel_tol = 1e-12
+  nl_abs_tol = 1e-14
+[]
+
+[Preconditioning]
+  [smp]
+    type = SMP
+    full = true
+  []
+[]
+
+[Outputs]
+  csv = true
+[]
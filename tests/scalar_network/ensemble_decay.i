@@ -0,0 +1,74 @@
+# A -> B with k = 2, integrated by ScalarNetworkTransient for two ensemble members that start
+# from A = 1 and A = 3. The exact solution is A = A0 exp(-2 t), B = A0 (1 - exp(-2 t)). The
+# postprocessors follow the first member, which is the same as a run without an ensemble.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  xmin = 0
+  xmax = 1
+  nx = 1
+[]
+
+[Variables]
+  [A]
+    family = SCALAR
+    order = FIRST
+    initial_condition = 1
+  []
+
+  [B]
+    family = SCALAR
+    order = FIRST
+    initial_condition = 0
+  []
+[]
+
+[ScalarKernels]
+  [dA_dt]
+    type = ODETimeDerivative
+    variable = A
+  []
+
+  [dB_dt]
+    type = ODETimeDerivative
+    variable = B
+  []
+[]
+
+[ChemicalReactions]
+  [ScalarNetwork]
+    species = 'A B'
+    use_network_kernel = true
+    reactions = 'A -> B : 2.0'
+  []
+[]
+
+[Postprocessors]
+  [A]
+    type = ScalarVariable
+    variable = A
+    execute_on = 'INITIAL TIMESTEP_END'
+  []
+
+  [B]
+    type = ScalarVariable
+    variable = B
+    execute_on = 'INITIAL TIMESTEP_END'
+  []
+[]
+
+[Executioner]
+  type = ScalarNetworkTransient
+  dt = 0.1
+  num_steps = 5
+  ode_relative_tolerance = 1e-7
+  ode_absolute_tolerance = 1e-10
+  ensemble_variables = 'A'
+  ensemble_values = '1; 3'
+  ensemble_file = 'ensemble_decay_members.csv'
+[]
+
+[Outputs]
+  csv = true
+[]
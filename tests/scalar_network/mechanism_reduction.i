@@ -0,0 +1,88 @@
+# A <-> B with a slow side branch A -> D -> E, reduced for the target B. The branch takes about
+# 1e-3 of the consumption of A, so D and E have an importance of about 1e-3 (DRG and DRGEP) and
+# are removed at the default threshold of 0.01 with the two reactions of the branch.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  xmin = 0
+  xmax = 1
+  nx = 1
+[]
+
+[Variables]
+  [A]
+    family = SCALAR
+    order = FIRST
+    initial_condition = 1
+  []
+
+  [B]
+    family = SCALAR
+    order = FIRST
+    initial_condition = 0
+  []
+
+  [D]
+    family = SCALAR
+    order = FIRST
+    initial_condition = 0
+  []
+
+  [E]
+    family = SCALAR
+    order = FIRST
+    initial_condition = 0
+  []
+[]
+
+[ScalarKernels]
+  [dA_dt]
+    type = ODETimeDerivative
+    variable = A
+  []
+
+  [dB_dt]
+    type = ODETimeDerivative
+    variable = B
+  []
+
+  [dD_dt]
+    type = ODETimeDerivative
+    variable = D
+  []
+
+  [dE_dt]
+    type = ODETimeDerivative
+    variable = E
+  []
+[]
+
+[ChemicalReactions]
+  [ScalarNetwork]
+    species = 'A B D E'
+    use_network_kernel = true
+    reduction_targets = 'B'
+    reduction_file = 'mechanism_reduction_drgep.txt'
+    reactions = 'A -> B : 1.0
+                 B -> A : 0.5
+                 A -> D : 1e-3
+                 D -> E : 1.0'
+  []
+[]
+
+[Executioner]
+  type = Transient
+  dt = 0.1
+  num_steps = 10
+  solve_type = 'newton'
+  nl_rel_tol = 1e-12
+  nl_abs_tol = 1e-14
+[]
+
+[Preconditioning]
+  [smp]
+    type = SMP
+    full = true
+  []
+[]
@@ -0,0 +1,87 @@
+# A -> I -> B with a short-lived intermediate I (k1 = 1, k2 = 1000) that is solved from its
+# quasi-steady balance I = k1 A / k2, so that dA/dt = -A and dB/dt = A. With backward Euler,
+# A_n = A_(n-1) / (1 + dt) and B_n = B_(n-1) + dt A_n.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  xmin = 0
+  xmax = 1
+  nx = 1
+[]
+
+[Variables]
+  [A]
+    family = SCALAR
+    order = FIRST
+    initial_condition = 1
+  []
+
+  [B]
+    family = SCALAR
+    order = FIRST
+    initial_condition = 0
+  []
+[]
+
+[ScalarKernels]
+  [dA_dt]
+    type = ODETimeDerivative
+    variable = A
+  []
+
+  [dB_dt]
+    type = ODETimeDerivative
+    variable = B
+  []
+[]
+
+[ChemicalReactions]
+  [ScalarNetwork]
+    species = 'A I B'
+    use_network_kernel = true
+    qss_species = 'I'
+    reactions = 'A -> I : 1.0
+                 I -> B : 1000.0'
+  []
+[]
+
+[Postprocessors]
+  [A]
+    type = ScalarVariable
+    variable = A
+    execute_on = 'INITIAL TIMESTEP_END'
+  []
+
+  [I]
+    type = ScalarVariable
+    variable = I
+    execute_on = 'INITIAL TIMESTEP_END'
+  []
+
+  [B]
+    type = ScalarVariable
+    variable = B
+    execute_on = 'INITIAL TIMESTEP_END'
+  []
+[]
+
+[Executioner]
+  type = Transient
+  dt = 0.1
+  num_steps = 5
+  solve_type = 'newton'
+  nl_rel_tol = 1e-12
+  nl_abs_tol = 1e-14
+[]
+
+[Preconditioning]
+  [smp]
+    type = SMP
+    full = true
+  []
+[]
+
+[Outputs]
+  csv = true
+[]
@@ -0,0 +1,79 @@
+# A -> B (k1 = 1) and A + A -> C (k2 = 0.5), with the reaction rates tracked in one vector
+# postprocessor. Since dA/dt = -A - A^2, backward Euler gives dt A_n^2 + (1 + dt) A_n = A_(n-1),
+# and the rates are r_0 = A_n and r_1 = 0.5 A_n^2.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  xmin = 0
+  xmax = 1
+  nx = 1
+[]
+
+[Variables]
+  [A]
+    family = SCALAR
+    order = FIRST
+    initial_condition = 1
+  []
+
+  [B]
+    family = SCALAR
+    order = FIRST
+    initial_condition = 0
+  []
+
+  [C]
+    family = SCALAR
+    order = FIRST
+    initial_condition = 0
+  []
+[]
+
+[ScalarKernels]
+  [dA_dt]
+    type = ODETimeDerivative
+    variable = A
+  []
+
+  [dB_dt]
+    type = ODETimeDerivative
+    variable = B
+  []
+
+  [dC_dt]
+    type = ODETimeDerivative
+    variable = C
+  []
+[]
+
+[ChemicalReactions]
+  [ScalarNetwork]
+    species = 'A B C'
+    use_network_kernel = true
+    track_rates = true
+    rate_tracking = vector
+    reactions = 'A -> B : 1.0
+                 A + A -> C : 0.5'
+  []
+[]
+
+[Executioner]
+  type = Transient
+  dt = 0.1
+  num_steps = 5
+  solve_type = 'newton'
+  nl_rel_tol = 1e-12
+  nl_abs_tol = 1e-14
+[]
+
+[Preconditioning]
+  [smp]
+    type = SMP
+    full = true
+  []
+[]
+
+[Outputs]
+  csv = true
+[]
@@ -0,0 +1,80 @@
+# Rate-of-production analysis of A in A -> B (k = 1), A + A -> C (k = 0.5) and C -> A (k = 0.2).
+# A is produced by reaction 2 only (0.2 C) and destroyed by reactions 0 (A) and 1 (A^2), so with
+# rop_top = 2 the second producer row is empty. The golds follow from the backward Euler solution.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  xmin = 0
+  xmax = 1
+  nx = 1
+[]
+
+[Variables]
+  [A]
+    family = SCALAR
+    order = FIRST
+    initial_condition = 1
+  []
+
+  [B]
+    family = SCALAR
+    order = FIRST
+    initial_condition = 0
+  []
+
+  [C]
+    family = SCALAR
+    order = FIRST
+    initial_condition = 0
+  []
+[]
+
+[ScalarKernels]
+  [dA_dt]
+    type = ODETimeDerivative
+    variable = A
+  []
+
+  [dB_dt]
+    type = ODETimeDerivative
+    variable = B
+  []
+
+  [dC_dt]
+    type = ODETimeDerivative
+    variable = C
+  []
+[]
+
+[ChemicalReactions]
+  [ScalarNetwork]
+    species = 'A B C'
+    use_network_kernel = true
+    rop_species = 'A'
+    rop_top = 2
+    reactions = 'A -> B : 1.0
+                 A + A -> C : 0.5
+                 C -> A : 0.2'
+  []
+[]
+
+[Executioner]
+  type = Transient
+  dt = 0.1
+  num_steps = 5
+  solve_type = 'newton'
+  nl_rel_tol = 1e-12
+  nl_abs_tol = 1e-14
+[]
+
+[Preconditioning]
+  [smp]
+    type = SMP
+    full = true
+  []
+[]
+
+[Outputs]
+  csv = true
+[]
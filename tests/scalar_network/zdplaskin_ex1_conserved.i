@@ -0,0 +1,96 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  xmin = 0
+  xmax = 1
+  nx = 1
+[]
+
+[Variables]
+  [Ar+]
+    family = SCALAR
+    order = FIRST
+    initial_condition = 1
+  []
+
+  [Ar]
+    family = SCALAR
+    order = FIRST
+    initial_condition = 2.5e19
+    scaling = 2.5e-19
+  []
+[]
+
+[ScalarKernels]
+  [dAr+_dt]
+    type = ODETimeDerivative
+    variable = Ar+
+  []
+
+  [dAr_dt]
+    type = ODETimeDerivative
+    variable = Ar
+  []
+[]
+
+[ChemicalReactions]
+  [ScalarNetwork]
+    species = 'e Ar+ Ar'
+    use_network_kernel = true
+    eliminate_conserved = true
+    file_location = 'Example1'
+    interpolation_type = 'spline'
+    reactions = 'e + Ar -> e + e + Ar+          : EEDF
+                 e + Ar+ + Ar -> Ar + Ar       : 1e-25'
+
+  []
+[]
+
+# The electrons are reconstructed from charge conservation (e - Ar+ is constant) instead of being
+# solved for
+[AuxVariables]
+  [e]
+    family = SCALAR
+    order = FIRST
+    initial_condition = 1
+  []
+
+  [reduced_field]
+    order = FIRST
+    family = SCALAR
+    initial_condition = 51e-21
+  []
+[]
+
+[Executioner]
+  type = Transient
+  end_time = 0.25e-6
+  dt = 1e-10
+  solve_type = 'newton'
+  dtmin = 1e-20
+  dtmax = 1e-8
+  petsc_options_iname = '-snes_linesearch_type'
+  petsc_options_value = 'basic'
+[]
+
+[Preconditioning]
+  active = 'smp'
+
+  [smp]
+    type = SMP
+    full = true
+  []
+
+  [fd]
+    type = FDP
+    full = true
+  []
+[]
+
+[Outputs]
+  [out]
+    type = Exodus
+    file_base = 'zdplaskin_ex1_out'
+    execute_on = 'TIMESTEP_END'
+  []
+[]